@@ -0,0 +1,367 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// ArrowGraph
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_ARROWGRAPH_HPP
+#define GRAMBOL_ARROWGRAPH_HPP
+
+#include "Arrows.hpp"
+#include "Geometry.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace grambol
+{
+
+// end of an arrow attached to a symbol. point is in the symbol's normalised (0-1) space.
+// when clipped to boundary, the arrow ends where it leaves (or enters) the symbol's geometry instead of at the point.
+// without a symbol, the arrow's own control point is used for that end.
+struct ArrowAnchor
+{
+	const Symbol* symbol{ nullptr };
+	sf::Vector2f point{ 0.5f, 0.5f };
+	bool isClippedToBoundary{ false };
+};
+
+// keeps arrows attached to the symbols they connect.
+// anchored symbols are observed: update() only visits the symbols that moved (or were resized or regenerated)
+// since the previous update and re-places the arrows attached to them. moves made through an sf::Transformable
+// reference are not seen (see Symbol::addObserver).
+// arrows are not owned and must outlive the graph (or be disconnected from it). when an anchored symbol is destroyed,
+// its arrows keep their control point for that end instead.
+class ArrowGraph
+{
+public:
+	ArrowGraph() : m_nodes(), m_edges(), m_nodeIndices(), m_edgeIndices(), m_dirtyEdges(), m_dirtyNodes() { }
+	ArrowGraph(const ArrowGraph&) = delete;
+	ArrowGraph& operator=(const ArrowGraph&) = delete;
+	~ArrowGraph();
+
+	void connect(ArrowBase& arrow, ArrowAnchor start, ArrowAnchor end);
+	void disconnect(ArrowBase& arrow);
+	void clear();
+	std::size_t getNumberOfArrows() const;
+	std::size_t getNumberOfSymbols() const;
+
+	std::size_t update(); // returns the number of arrows that were re-placed
+
+private:
+	static constexpr std::size_t noNode{ static_cast<std::size_t>(-1) };
+
+	struct Node
+	{
+		const Symbol* symbol;
+		std::size_t observerId;
+		std::vector<std::size_t> edges;
+		bool isDirty;
+	};
+	struct Edge
+	{
+		ArrowBase* arrow;
+		ArrowAnchor start;
+		ArrowAnchor end;
+		std::size_t startNode;
+		std::size_t endNode;
+		bool isDirty;
+	};
+
+	std::vector<Node> m_nodes;
+	std::vector<Edge> m_edges;
+	std::unordered_map<const Symbol*, std::size_t> m_nodeIndices;
+	std::unordered_map<const ArrowBase*, std::size_t> m_edgeIndices;
+	std::vector<std::size_t> m_dirtyEdges;
+	std::vector<std::size_t> m_dirtyNodes;
+	std::vector<sf::Vertex> m_triangles;
+
+	std::size_t priv_attach(const Symbol* symbol, std::size_t edgeIndex);
+	void priv_detach(std::size_t nodeIndex, std::size_t edgeIndex);
+	void priv_removeNode(std::size_t nodeIndex);
+	void priv_onSymbolChanged(const Symbol& symbol, SymbolChange change);
+	void priv_renameEdge(std::size_t nodeIndex, std::size_t from, std::size_t to);
+	void priv_markDirty(std::size_t edgeIndex);
+	void priv_place(const Edge& edge);
+	float priv_getClipRatio(const Symbol& symbol, sf::Vector2f start, sf::Vector2f end, bool isLastExit);
+};
+
+inline ArrowGraph::~ArrowGraph()
+{
+	clear();
+}
+
+inline void ArrowGraph::connect(ArrowBase& arrow, const ArrowAnchor start, const ArrowAnchor end)
+{
+	disconnect(arrow);
+	const std::size_t edgeIndex{ m_edges.size() };
+	m_edges.push_back({ &arrow, start, end, noNode, noNode, false });
+	m_edgeIndices.emplace(&arrow, edgeIndex);
+	m_edges[edgeIndex].startNode = priv_attach(start.symbol, edgeIndex);
+	m_edges[edgeIndex].endNode = priv_attach(end.symbol, edgeIndex);
+	priv_markDirty(edgeIndex);
+}
+
+inline void ArrowGraph::disconnect(ArrowBase& arrow)
+{
+	auto it{ m_edgeIndices.find(&arrow) };
+	if (it == m_edgeIndices.end())
+		return;
+	const std::size_t edgeIndex{ it->second };
+	m_edgeIndices.erase(it);
+	const bool isLoop{ m_edges[edgeIndex].startNode == m_edges[edgeIndex].endNode };
+	priv_detach(m_edges[edgeIndex].startNode, edgeIndex);
+	if (!isLoop)
+		priv_detach(m_edges[edgeIndex].endNode, edgeIndex);
+
+	// move the last edge into the freed slot
+	const std::size_t lastEdgeIndex{ m_edges.size() - 1u };
+	if (edgeIndex != lastEdgeIndex)
+	{
+		Edge& moved{ m_edges[edgeIndex] = m_edges[lastEdgeIndex] };
+		m_edgeIndices[moved.arrow] = edgeIndex;
+		priv_renameEdge(moved.startNode, lastEdgeIndex, edgeIndex);
+		if (moved.endNode != moved.startNode)
+			priv_renameEdge(moved.endNode, lastEdgeIndex, edgeIndex);
+		if (moved.isDirty)
+			m_dirtyEdges.push_back(edgeIndex);
+	}
+	m_edges.pop_back();
+}
+
+inline void ArrowGraph::clear()
+{
+	for (auto& node : m_nodes)
+		node.symbol->removeObserver(node.observerId);
+	m_nodes.clear();
+	m_edges.clear();
+	m_nodeIndices.clear();
+	m_edgeIndices.clear();
+	m_dirtyEdges.clear();
+	m_dirtyNodes.clear();
+}
+
+inline std::size_t ArrowGraph::getNumberOfArrows() const
+{
+	return m_edges.size();
+}
+
+inline std::size_t ArrowGraph::getNumberOfSymbols() const
+{
+	return m_nodes.size();
+}
+
+inline std::size_t ArrowGraph::update()
+{
+	for (auto& nodeIndex : m_dirtyNodes)
+	{
+		if ((nodeIndex >= m_nodes.size()) || !m_nodes[nodeIndex].isDirty)
+			continue;
+		for (auto& edgeIndex : m_nodes[nodeIndex].edges)
+			priv_markDirty(edgeIndex);
+		m_nodes[nodeIndex].isDirty = false;
+	}
+	m_dirtyNodes.clear();
+
+	std::size_t numberOfPlacedArrows{ 0u };
+	for (auto& edgeIndex : m_dirtyEdges)
+	{
+		if ((edgeIndex >= m_edges.size()) || !m_edges[edgeIndex].isDirty)
+			continue;
+		priv_place(m_edges[edgeIndex]);
+		m_edges[edgeIndex].isDirty = false;
+		++numberOfPlacedArrows;
+	}
+	m_dirtyEdges.clear();
+	return numberOfPlacedArrows;
+}
+
+inline std::size_t ArrowGraph::priv_attach(const Symbol* const symbol, const std::size_t edgeIndex)
+{
+	if (symbol == nullptr)
+		return noNode;
+	auto it{ m_nodeIndices.find(symbol) };
+	if (it == m_nodeIndices.end())
+	{
+		it = m_nodeIndices.emplace(symbol, m_nodes.size()).first;
+		const std::size_t observerId{ symbol->addObserver([this](const Symbol& changed, const SymbolChange change) { priv_onSymbolChanged(changed, change); }) };
+		m_nodes.push_back({ symbol, observerId, {}, false });
+	}
+	std::vector<std::size_t>& edges{ m_nodes[it->second].edges };
+	if (edges.empty() || (edges.back() != edgeIndex))
+		edges.push_back(edgeIndex);
+	return it->second;
+}
+
+inline void ArrowGraph::priv_detach(const std::size_t nodeIndex, const std::size_t edgeIndex)
+{
+	if (nodeIndex == noNode)
+		return;
+	std::vector<std::size_t>& edges{ m_nodes[nodeIndex].edges };
+	auto it{ std::find(edges.begin(), edges.end(), edgeIndex) };
+	if (it == edges.end())
+		return;
+	*it = edges.back();
+	edges.pop_back();
+	if (!edges.empty())
+		return;
+
+	// remove the symbol when it has no more arrows
+	m_nodes[nodeIndex].symbol->removeObserver(m_nodes[nodeIndex].observerId);
+	priv_removeNode(nodeIndex);
+}
+
+// moves the last node into the removed node's slot (the node's observer must already be removed)
+inline void ArrowGraph::priv_removeNode(const std::size_t nodeIndex)
+{
+	m_nodeIndices.erase(m_nodes[nodeIndex].symbol);
+	const std::size_t lastNodeIndex{ m_nodes.size() - 1u };
+	if (nodeIndex != lastNodeIndex)
+	{
+		Node& moved{ m_nodes[nodeIndex] = std::move(m_nodes[lastNodeIndex]) };
+		m_nodeIndices[moved.symbol] = nodeIndex;
+		for (auto& movedEdgeIndex : moved.edges)
+		{
+			Edge& edge{ m_edges[movedEdgeIndex] };
+			if (edge.startNode == lastNodeIndex)
+				edge.startNode = nodeIndex;
+			if (edge.endNode == lastNodeIndex)
+				edge.endNode = nodeIndex;
+		}
+		if (moved.isDirty)
+			m_dirtyNodes.push_back(nodeIndex);
+	}
+	m_nodes.pop_back();
+}
+
+inline void ArrowGraph::priv_onSymbolChanged(const Symbol& symbol, const SymbolChange change)
+{
+	if (change == SymbolChange::Color)
+		return;
+	auto it{ m_nodeIndices.find(&symbol) };
+	if (it == m_nodeIndices.end())
+		return;
+	const std::size_t nodeIndex{ it->second };
+	if (change != SymbolChange::Destroyed)
+	{
+		if (!m_nodes[nodeIndex].isDirty)
+		{
+			m_nodes[nodeIndex].isDirty = true;
+			m_dirtyNodes.push_back(nodeIndex);
+		}
+		return;
+	}
+
+	// the symbol's arrows fall back to their own control points for its ends (its observer goes with it)
+	for (auto& edgeIndex : m_nodes[nodeIndex].edges)
+	{
+		Edge& edge{ m_edges[edgeIndex] };
+		if (edge.startNode == nodeIndex)
+		{
+			edge.start.symbol = nullptr;
+			edge.startNode = noNode;
+		}
+		if (edge.endNode == nodeIndex)
+		{
+			edge.end.symbol = nullptr;
+			edge.endNode = noNode;
+		}
+		priv_markDirty(edgeIndex);
+	}
+	priv_removeNode(nodeIndex);
+}
+
+inline void ArrowGraph::priv_renameEdge(const std::size_t nodeIndex, const std::size_t from, const std::size_t to)
+{
+	if (nodeIndex == noNode)
+		return;
+	for (auto& edgeIndex : m_nodes[nodeIndex].edges)
+	{
+		if (edgeIndex == from)
+			edgeIndex = to;
+	}
+}
+
+inline void ArrowGraph::priv_markDirty(const std::size_t edgeIndex)
+{
+	if (m_edges[edgeIndex].isDirty)
+		return;
+	m_edges[edgeIndex].isDirty = true;
+	m_dirtyEdges.push_back(edgeIndex);
+}
+
+inline void ArrowGraph::priv_place(const Edge& edge)
+{
+	ArrowBase& arrow{ *edge.arrow };
+	auto getAnchorPoint = [](const ArrowAnchor& anchor, const sf::Vector2f controlPoint)
+	{
+		if (anchor.symbol == nullptr)
+			return controlPoint;
+		const sf::Vector2f size{ anchor.symbol->m_size };
+		return anchor.symbol->getTransform().transformPoint({ anchor.point.x * size.x, anchor.point.y * size.y });
+	};
+	const sf::Vector2f start{ getAnchorPoint(edge.start, arrow.getStartControlPoint()) };
+	const sf::Vector2f end{ getAnchorPoint(edge.end, arrow.getEndControlPoint()) };
+
+	float startRatio{ 0.f };
+	float endRatio{ 1.f };
+	if (edge.start.isClippedToBoundary && (edge.start.symbol != nullptr))
+		startRatio = priv_getClipRatio(*edge.start.symbol, start, end, true);
+	if (edge.end.isClippedToBoundary && (edge.end.symbol != nullptr))
+		endRatio = priv_getClipRatio(*edge.end.symbol, start, end, false);
+	if (endRatio < startRatio) // symbols overlap
+		endRatio = startRatio;
+
+	const sf::Vector2f direction{ end - start };
+	arrow.setControlPoints(start + direction * startRatio, start + direction * endRatio);
+	arrow.updateFromControlPoints();
+}
+
+// ratio along the line where it last leaves (or first enters) the symbol's triangles; 0 (or 1) if it does not cross them
+inline float ArrowGraph::priv_getClipRatio(const Symbol& symbol, const sf::Vector2f start, const sf::Vector2f end, const bool isLastExit)
+{
+	m_triangles.clear();
+	priv::appendAsTriangles(m_triangles, symbol.priv_getOutputVertices(), symbol.priv_getOutputPrimitiveType(), symbol.getTransform() * symbol.priv_getLocalTransform());
+	float clipRatio{ isLastExit ? 0.f : 1.f };
+	for (std::size_t i{ 0u }; i + 2u < m_triangles.size(); i += 3u)
+	{
+		for (std::size_t j{ 0u }; j < 3u; ++j)
+		{
+			float ratio;
+			if (!geometry::getSegmentIntersectionRatio(start, end, m_triangles[i + j].position, m_triangles[i + (j + 1u) % 3u].position, ratio))
+				continue;
+			if (isLastExit ? (ratio > clipRatio) : (ratio < clipRatio))
+				clipRatio = ratio;
+		}
+	}
+	return clipRatio;
+}
+
+} // namespace grambol
+#endif // GRAMBOL_ARROWGRAPH_HPP
@@ -34,7 +34,10 @@
 #define GRAMBOL_ARROWS_HPP
 
 #include "PlainSymbol.hpp"
+#include "Generators.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 
 #include <iostream>
@@ -60,7 +63,10 @@ class Arrow { Arrow() = delete; };
 class ArrowBase : public PlainSymbol
 {
 public:
-	ArrowBase(sf::PrimitiveType primitiveType) : PlainSymbol(primitiveType) { }
+	ArrowBase(sf::PrimitiveType primitiveType) : PlainSymbol(primitiveType), m_standardPrimitiveType{ primitiveType }, m_topology{ Topology::Standard } { }
+
+	void setTopology(Topology topology) { m_topology = topology; priv_setPrimitiveType(priv_isOptimised() ? sf::PrimitiveType::Triangles : m_standardPrimitiveType); priv_update(); }
+	Topology getTopology() const { return priv_isOptimised() ? Topology::Optimised : Topology::Standard; } // standard if optimised is not supported
 
 	void setControlPoints(sf::Vector2f start, sf::Vector2f end) { setStartControlPoint(start); setEndControlPoint(end); }
 	void setStartControlPoint(sf::Vector2f point) { m_startControlPoint = point; }
@@ -106,18 +112,48 @@ public:
 		setEndControlPoint(transform.transformPoint({ size.x, centerY }));
 	}
 
+protected:
+	bool priv_isOptimised() const { return (m_topology == Topology::Optimised) && priv_isOptimisedTopologySupported(); }
+
+	// arrows whose standard strip already has no overlapping or degenerate triangles keep it
+	virtual bool priv_isOptimisedTopologySupported() const { return true; }
+
+	// the vertex of the standard topology's strip that the vertex is (the optimised topology repeats them)
+	virtual std::size_t priv_getStripVertexIndex(std::size_t vertexIndex) const = 0;
+
+	// regenerates only the vertices that a parameter moves, given as indices into the standard topology's strip
+	void priv_updateStripVertices(const std::initializer_list<std::size_t> stripVertexIndices)
+	{
+		std::array<VertexRange, 24u> ranges;
+		const std::size_t numberOfVertices{ priv_getNumberOfVertices() };
+		if (numberOfVertices > ranges.size())
+		{
+			priv_update();
+			return;
+		}
+		std::size_t numberOfRanges{ 0u };
+		for (std::size_t i{ 0u }; i < numberOfVertices; ++i)
+		{
+			if (std::find(stripVertexIndices.begin(), stripVertexIndices.end(), priv_getStripVertexIndex(i)) != stripVertexIndices.end())
+				ranges[numberOfRanges++] = { i, 1u };
+		}
+		priv_updateRanges(ranges.data(), numberOfRanges);
+	}
+
 private:
 	sf::Vector2f m_startControlPoint;
 	sf::Vector2f m_endControlPoint;
+	const sf::PrimitiveType m_standardPrimitiveType;
+	Topology m_topology;
 };
 
 template <>
 class Arrow<Selection::Arrow::Dart> : public ArrowBase
 {
 public:
-	Arrow() : ArrowBase(sf::PrimitiveType::TriangleStrip), m_innerDistanceMultiplier(0.25f) { }
+	Arrow() : ArrowBase(sf::PrimitiveType::TriangleStrip), m_innerDistanceMultiplier(0.25f) { priv_setSizeIndependent(true); }
 
-	void setInnerDistanceMultiplier(float innerDistanceMultiplier) { m_innerDistanceMultiplier = innerDistanceMultiplier; priv_update(); }
+	void setInnerDistanceMultiplier(float innerDistanceMultiplier) { m_innerDistanceMultiplier = innerDistanceMultiplier; priv_updateStripVertices({ 2u }); }
 	float getInnerDistanceMultiplier() const { return m_innerDistanceMultiplier; }
 
 private:
@@ -125,6 +161,8 @@ private:
 
 	virtual std::size_t priv_getNumberOfVertices() const final override { return 4u; }
 	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
+	virtual std::size_t priv_getStripVertexIndex(std::size_t vertexIndex) const final override { return vertexIndex; }
+	virtual bool priv_isOptimisedTopologySupported() const final override { return false; } // the strip is already two distinct triangles
 };
 
 template <>
@@ -139,15 +177,15 @@ public:
 		, m_headOvershootSize(0.f)
 	{ }
 
-	void setStartThickness(float startThickness) { m_startThickness = startThickness; priv_update(); }
+	void setStartThickness(float startThickness) { m_startThickness = startThickness; priv_updateStripVertices({ 8u, 9u }); }
 	float getStartThickness() const { return m_startThickness; }
-	void setEndThickness(float endThickness) { m_endThickness = endThickness; priv_update(); }
+	void setEndThickness(float endThickness) { m_endThickness = endThickness; priv_updateStripVertices({ 1u, 3u, 6u, 7u }); }
 	float getEndThickness() const { return m_endThickness; }
-	void setThicknesses(float startThickness, float endThickness) { setStartThickness(startThickness); setEndThickness(endThickness); priv_update(); }
-	void setThickness(float thickness) { setThicknesses(thickness, thickness); priv_update(); }
-	void setHeadSize(float headSize) { m_headSize = headSize; priv_update(); }
+	void setThicknesses(float startThickness, float endThickness) { setStartThickness(startThickness); setEndThickness(endThickness); }
+	void setThickness(float thickness) { setThicknesses(thickness, thickness); }
+	void setHeadSize(float headSize) { m_headSize = headSize; priv_updateStripVertices({ 0u, 1u, 3u, 4u, 6u, 7u }); }
 	float getHeadSize() const { return m_headSize; }
-	void setHeadOvershootSize(float headOvershootSize) { m_headOvershootSize = headOvershootSize; priv_update(); }
+	void setHeadOvershootSize(float headOvershootSize) { m_headOvershootSize = headOvershootSize; priv_updateStripVertices({ 0u, 4u }); }
 	float getHeadOvershootSize() const { return m_headOvershootSize; }
 
 private:
@@ -156,8 +194,9 @@ private:
 	float m_headSize;
 	float m_headOvershootSize;
 
-	virtual std::size_t priv_getNumberOfVertices() const final override { return 10u; }
+	virtual std::size_t priv_getNumberOfVertices() const final override { return generator::getNumberOfStandardArrowVertices(priv_isOptimised()); }
 	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
+	virtual std::size_t priv_getStripVertexIndex(std::size_t vertexIndex) const final override { return generator::getStandardArrowStripVertexIndex(priv_isOptimised(), vertexIndex); }
 };
 
 template <>
@@ -176,30 +215,30 @@ public:
 		, m_endHeadOvershootSize(0.f)
 	{ }
 
-	void setStartThickness(float startThickness) { m_startThickness = startThickness; priv_update(); }
+	void setStartThickness(float startThickness) { m_startThickness = startThickness; priv_updateStripVertices({ 8u, 9u, 12u, 14u }); }
 	float getStartThickness() const { return m_startThickness; }
-	void setEndThickness(float endThickness) { m_endThickness = endThickness; priv_update(); }
+	void setEndThickness(float endThickness) { m_endThickness = endThickness; priv_updateStripVertices({ 1u, 3u, 6u, 7u }); }
 	float getEndThickness() const { return m_endThickness; }
-	void setThicknesses(float startThickness, float endThickness) { setStartThickness(startThickness); setEndThickness(endThickness); priv_update(); }
-	void setThickness(float thickness) { setThicknesses(thickness, thickness); priv_update(); }
-	void setStartHeadSize(float startHeadSize) { m_startHeadSize = startHeadSize; priv_update(); }
+	void setThicknesses(float startThickness, float endThickness) { setStartThickness(startThickness); setEndThickness(endThickness); }
+	void setThickness(float thickness) { setThicknesses(thickness, thickness); }
+	void setStartHeadSize(float startHeadSize) { m_startHeadSize = startHeadSize; priv_updateStripVertices({ 8u, 9u, 11u, 12u, 14u, 15u }); }
 	float getStartHeadSize() const { return m_startHeadSize; }
-	void setEndHeadSize(float endHeadSize) { m_endHeadSize = endHeadSize; priv_update(); }
+	void setEndHeadSize(float endHeadSize) { m_endHeadSize = endHeadSize; priv_updateStripVertices({ 0u, 1u, 3u, 4u, 6u, 7u }); }
 	float getEndHeadSize() const { return m_endHeadSize; }
-	void setHeadSizes(float startHeadSize, float endHeadSize) { setStartHeadSize(startHeadSize); setEndHeadSize(endHeadSize); priv_update(); }
-	void setHeadSizes(float headSize) { setHeadSizes(headSize, headSize); priv_update(); }
-	void setStartHeadWidthMultiplier(float startHeadWidthMultiplier) { m_startHeadWidthMultiplier = startHeadWidthMultiplier; priv_update(); }
+	void setHeadSizes(float startHeadSize, float endHeadSize) { setStartHeadSize(startHeadSize); setEndHeadSize(endHeadSize); }
+	void setHeadSizes(float headSize) { setHeadSizes(headSize, headSize); }
+	void setStartHeadWidthMultiplier(float startHeadWidthMultiplier) { m_startHeadWidthMultiplier = startHeadWidthMultiplier; priv_updateStripVertices({ 11u, 15u }); }
 	float getStartHeadWidthMultiplier() const { return m_startHeadWidthMultiplier; }
-	void setEndHeadWidthMultiplier(float endHeadWidthMultiplier) { m_endHeadWidthMultiplier = endHeadWidthMultiplier; priv_update(); }
+	void setEndHeadWidthMultiplier(float endHeadWidthMultiplier) { m_endHeadWidthMultiplier = endHeadWidthMultiplier; priv_updateStripVertices({ 0u, 4u }); }
 	float getEndHeadWidthMultiplier() const { return m_endHeadWidthMultiplier; }
-	void setHeadWidthMultipliers(float startHeadWidthMultiplier, float endHeadWidthMultiplier) { setStartHeadWidthMultiplier(startHeadWidthMultiplier); setEndHeadWidthMultiplier(endHeadWidthMultiplier); priv_update(); }
-	void setHeadWidthMultipliers(float headWidthMultiplier) { setHeadSizes(headWidthMultiplier, headWidthMultiplier); priv_update(); }
-	void setStartHeadOvershootSize(float startHeadOvershootSize) { m_startHeadOvershootSize = startHeadOvershootSize; priv_update(); }
+	void setHeadWidthMultipliers(float startHeadWidthMultiplier, float endHeadWidthMultiplier) { setStartHeadWidthMultiplier(startHeadWidthMultiplier); setEndHeadWidthMultiplier(endHeadWidthMultiplier); }
+	void setHeadWidthMultipliers(float headWidthMultiplier) { setHeadWidthMultipliers(headWidthMultiplier, headWidthMultiplier); }
+	void setStartHeadOvershootSize(float startHeadOvershootSize) { m_startHeadOvershootSize = startHeadOvershootSize; priv_updateStripVertices({ 11u, 15u }); }
 	float getStartHeadOvershootSize() const { return m_startHeadOvershootSize; }
-	void setEndHeadOvershootSize(float endHeadOvershootSize) { m_endHeadOvershootSize = endHeadOvershootSize; priv_update(); }
+	void setEndHeadOvershootSize(float endHeadOvershootSize) { m_endHeadOvershootSize = endHeadOvershootSize; priv_updateStripVertices({ 0u, 4u }); }
 	float getEndHeadOvershootSize() const { return m_endHeadOvershootSize; }
-	void setHeadOvershootSizes(float startHeadOvershootSize, float endHeadOvershootSize) { setStartHeadOvershootSize(startHeadOvershootSize); setEndHeadOvershootSize(endHeadOvershootSize); priv_update(); }
-	void setHeadOvershootSizes(float headOvershootSize) { setHeadOvershootSizes(headOvershootSize, headOvershootSize); priv_update(); }
+	void setHeadOvershootSizes(float startHeadOvershootSize, float endHeadOvershootSize) { setStartHeadOvershootSize(startHeadOvershootSize); setEndHeadOvershootSize(endHeadOvershootSize); }
+	void setHeadOvershootSizes(float headOvershootSize) { setHeadOvershootSizes(headOvershootSize, headOvershootSize); }
 
 private:
 	float m_startThickness;
@@ -211,8 +250,9 @@ private:
 	float m_startHeadOvershootSize;
 	float m_endHeadOvershootSize;
 
-	virtual std::size_t priv_getNumberOfVertices() const final override { return 16u; }
+	virtual std::size_t priv_getNumberOfVertices() const final override { return priv_isOptimised() ? 24u : 16u; }
 	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
+	virtual std::size_t priv_getStripVertexIndex(std::size_t vertexIndex) const final override;
 };
 
 
@@ -223,7 +263,6 @@ private:
 
 sf::Vector2f Arrow<Selection::Arrow::Dart>::priv_getVertexPosition(const std::size_t vertexIndex) const
 {
-	//const sf::Vector2f size{ getSize() };
 	const sf::Vector2f center{ 0.5f, 0.5f };
 	switch (vertexIndex)
 	{
@@ -241,47 +280,14 @@ sf::Vector2f Arrow<Selection::Arrow::Dart>::priv_getVertexPosition(const std::si
 
 sf::Vector2f Arrow<Selection::Arrow::Standard>::priv_getVertexPosition(const std::size_t vertexIndex) const
 {
-	const sf::Vector2f size{ getSize() };
-	const float centerY{ 0.5f };
-	const float startThickness{ m_startThickness / size.y };
-	const float endThickness{ m_endThickness / size.y };
-	const float headSize{ m_headSize / size.x };
-	const float headOvershootSize{ m_headOvershootSize / size.x };
+	return generator::getStandardArrowVertexPosition(getSize(), m_startThickness, m_endThickness, m_headSize, m_headOvershootSize, priv_isOptimised(), vertexIndex);
+}
 
-	const float startHalfThickness{ startThickness / 2.f };
-	const float endHalfThickness{ endThickness / 2.f };
-	const float startBarTop{ centerY - startHalfThickness };
-	const float startBarBottom{ centerY + startHalfThickness };
-	const float endBarTop{ centerY - endHalfThickness };
-	const float endBarBottom{ centerY + endHalfThickness };
-	const float headInside{ 1.f - headSize };
-	const float headOvershoot{ headInside - headOvershootSize };
-	const sf::Vector2f endPoint{ 1.f, centerY };
-	switch (vertexIndex)
-	{
-	case 0u:
-		return{ headOvershoot, 0.f };
-	case 1u:
-		return{ headInside, endBarTop };
-	case 2u:
-		return endPoint;
-	case 3u:
-		return{ headInside, endBarBottom };
-	case 4u:
-		return{ headOvershoot, 1.f };
-	case 5u:
-		return endPoint;
-	case 6u:
-		return{ headInside, endBarBottom };
-	case 7u:
-		return{ headInside, endBarTop };
-	case 8u:
-		return{ 0.f, startBarBottom };
-	case 9u:
-		return{ 0.f, startBarTop };
-	default:
-		return endPoint;
-	}
+// end head, bar, then start head (three triangles, each head meeting at its point)
+inline std::size_t Arrow<Selection::Arrow::StandardDoubleEnded>::priv_getStripVertexIndex(const std::size_t vertexIndex) const
+{
+	constexpr std::size_t optimisedStripIndices[]{ 0u, 1u, 2u, 1u, 3u, 2u, 3u, 4u, 2u, 1u, 3u, 8u, 1u, 8u, 9u, 9u, 11u, 10u, 9u, 10u, 8u, 8u, 10u, 15u };
+	return priv_isOptimised() ? optimisedStripIndices[vertexIndex % 24u] : vertexIndex;
 }
 
 sf::Vector2f Arrow<Selection::Arrow::StandardDoubleEnded>::priv_getVertexPosition(const std::size_t vertexIndex) const
@@ -325,7 +331,8 @@ sf::Vector2f Arrow<Selection::Arrow::StandardDoubleEnded>::priv_getVertexPositio
 	const float endHeadBottom{ centerY + endHeadHalfWidth };
 	const sf::Vector2f startPoint{ 0.f, centerY };
 	const sf::Vector2f endPoint{ 1.f, centerY };
-	switch (vertexIndex)
+
+	switch (priv_getStripVertexIndex(vertexIndex))
 	{
 	case 0u:
 		return{ endHeadOvershoot, endHeadTop };
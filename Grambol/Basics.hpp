@@ -34,6 +34,7 @@
 #define GRAMBOL_BASICS_HPP
 
 #include "PlainSymbol.hpp"
+#include "Generators.hpp"
 
 #include <cmath>
 
@@ -53,10 +54,41 @@ namespace Selection
 		RoundedFrame,
 		RegularPolygon,
 		Parallelogram,
+		Pie,
+		Ring,
+		Arc,
 	};
 
 } // namespace Selection
 
+namespace priv
+{
+
+// shared by the swept basics (Pie, Ring and Arc). angles are clockwise on screen from the positive x axis.
+// changing only the sweep angle regenerates just the vertices from the earlier of the old and new ends onwards.
+class SweptBasic : public PlainSymbol
+{
+public:
+	void setNumberOfEdges(std::size_t numberOfEdges) { m_numberOfEdges = (numberOfEdges < 4u) ? 3u : numberOfEdges; priv_update(); } // for a full turn
+	std::size_t getNumberOfEdges() const { return m_numberOfEdges; }
+	void setStartAngle(sf::Angle startAngle) { m_startRadians = startAngle.asRadians(); priv_update(); }
+	sf::Angle getStartAngle() const { return sf::radians(m_startRadians); }
+	void setSweepAngle(sf::Angle sweepAngle);
+	sf::Angle getSweepAngle() const { return sf::radians(m_sweepRadians); }
+
+protected:
+	SweptBasic(sf::PrimitiveType primitiveType, sf::Angle sweepAngle) : PlainSymbol(primitiveType), m_numberOfEdges(72u), m_startRadians{ 0.f }, m_sweepRadians{ sweepAngle.asRadians() } { }
+
+	std::size_t m_numberOfEdges;
+	float m_startRadians;
+	float m_sweepRadians;
+
+private:
+	virtual std::size_t priv_getFirstVertexOfSweepPoint(std::size_t pointIndex) const = 0;
+};
+
+} // namespace priv
+
 template <Selection::Basic>
 class Basic { Basic() = delete; };
 
@@ -64,10 +96,10 @@ template <>
 class Basic<Selection::Basic::Rectangle> : public PlainSymbol
 {
 public:
-	Basic() : PlainSymbol(sf::PrimitiveType::TriangleStrip) { }
+	Basic() : PlainSymbol(sf::PrimitiveType::TriangleStrip) { priv_setSizeIndependent(true); }
 
 private:
-	virtual std::size_t priv_getNumberOfVertices() const final override { return 4u; }
+	virtual std::size_t priv_getNumberOfVertices() const final override { return generator::getNumberOfRectangleVertices(); }
 	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
 };
 
@@ -75,7 +107,7 @@ template <>
 class Basic<Selection::Basic::Ellipse> : public PlainSymbol
 {
 public:
-	Basic() : PlainSymbol(sf::PrimitiveType::TriangleFan), m_numberOfEdges(36u) { }
+	Basic() : PlainSymbol(sf::PrimitiveType::TriangleFan), m_numberOfEdges(36u) { priv_setSizeIndependent(true); }
 
 	void setNumberOfEdges(std::size_t numberOfEdges) { m_numberOfEdges = (numberOfEdges < 4u) ? 3u : numberOfEdges; priv_update(); }
 	std::size_t getNumberOfEdges() const { return m_numberOfEdges; }
@@ -83,7 +115,7 @@ public:
 private:
 	std::size_t m_numberOfEdges;
 
-	virtual std::size_t priv_getNumberOfVertices() const override { return m_numberOfEdges + 2u; }
+	virtual std::size_t priv_getNumberOfVertices() const override { return generator::getNumberOfEllipseVertices(m_numberOfEdges); }
 	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
 };
 
@@ -91,11 +123,11 @@ template <>
 class Basic<Selection::Basic::Star> : public PlainSymbol
 {
 public:
-	Basic() : PlainSymbol(sf::PrimitiveType::TriangleFan), m_numberOfSpikes(5u), m_innerDistanceMultiplier(0.38196601125010515179541316563436f) { }
+	Basic() : PlainSymbol(sf::PrimitiveType::TriangleFan), m_numberOfSpikes(5u), m_innerDistanceMultiplier(0.38196601125010515179541316563436f) { priv_setSizeIndependent(true); }
 
 	void setNumberOfSpikes(std::size_t numberOfSpikes) { m_numberOfSpikes = (numberOfSpikes < 4u) ? 3u : numberOfSpikes; priv_update(); }
 	std::size_t getNumberOfEdges() const { return m_numberOfSpikes * 2u; }
-	void setInnerDistanceMultiplier(float innerDistanceMultiplier) { m_innerDistanceMultiplier = innerDistanceMultiplier; priv_update(); }
+	void setInnerDistanceMultiplier(float innerDistanceMultiplier) { m_innerDistanceMultiplier = innerDistanceMultiplier; priv_updateRange({ 2u, m_numberOfSpikes, 2u }); } // inner vertices
 	float getInnerDistanceMultiplier() const { return m_innerDistanceMultiplier; }
 	void setInnerDistanceMultiplierAutomatically(unsigned int spikeStep = 2u)
 	{
@@ -106,7 +138,7 @@ private:
 	std::size_t m_numberOfSpikes;
 	float m_innerDistanceMultiplier;
 
-	virtual std::size_t priv_getNumberOfVertices() const final override { return (m_numberOfSpikes * 2u) + 2u; }
+	virtual std::size_t priv_getNumberOfVertices() const final override { return generator::getNumberOfStarVertices(m_numberOfSpikes); }
 	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
 };
 
@@ -114,9 +146,9 @@ template <>
 class Basic<Selection::Basic::Frame> : public PlainSymbol
 {
 public:
-	Basic() : PlainSymbol(sf::PrimitiveType::TriangleStrip), m_thickness(10.f) { }
+	Basic() : PlainSymbol(sf::PrimitiveType::TriangleStrip), m_thickness(10.f) { priv_setSizeIndependent(true); }
 
-	void setThickness(float thickness) { m_thickness = thickness; priv_update(); }
+	void setThickness(float thickness) { m_thickness = thickness; priv_updateRange(priv_getSizeDependentVertices()); }
 	float getThickness() const { return m_thickness; }
 
 private:
@@ -124,6 +156,7 @@ private:
 
 	virtual std::size_t priv_getNumberOfVertices() const final override { return 10u; }
 	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
+	virtual VertexRange priv_getSizeDependentVertices() const final override { return{ 1u, VertexRange::all, 2u }; } // inner vertices
 };
 
 template <>
@@ -150,7 +183,10 @@ template <>
 class Basic<Selection::Basic::RoundedFrame> : public PlainSymbol
 {
 public:
-	Basic() : PlainSymbol(sf::PrimitiveType::TriangleStrip), m_numberOfCornerEdges(16u), m_thickness(10.f), m_outerCornerRadius{ 10.f, 10.f }, m_innerCornerRadius{ 5.f, 5.f } { }
+	Basic() : PlainSymbol(sf::PrimitiveType::TriangleStrip), m_numberOfCornerEdges(16u), m_thickness(10.f), m_outerCornerRadius{ 10.f, 10.f }, m_innerCornerRadius{ 5.f, 5.f }, m_topology{ Topology::Standard } { }
+
+	void setTopology(Topology topology) { m_topology = topology; priv_setPrimitiveType((m_topology == Topology::Optimised) ? sf::PrimitiveType::Triangles : sf::PrimitiveType::TriangleStrip); priv_update(); }
+	Topology getTopology() const { return m_topology; }
 
 	void setNumberOfCornerEdges(std::size_t numberOfCornerEdges) { m_numberOfCornerEdges = (numberOfCornerEdges < 1u) ? 1u : numberOfCornerEdges; priv_update(); }
 	std::size_t getNumberOfCornerEdges() const { return m_numberOfCornerEdges; }
@@ -168,8 +204,11 @@ private:
 	float m_thickness;
 	sf::Vector2f m_outerCornerRadius;
 	sf::Vector2f m_innerCornerRadius;
+	Topology m_topology;
 
-	virtual std::size_t priv_getNumberOfVertices() const final override { return (m_numberOfCornerEdges + 1u) * 8u + 2u; }
+	std::size_t priv_getNumberOfOptimisedTrianglesPerCornerStep() const;
+	std::size_t priv_getStripVertexIndex(std::size_t optimisedVertexIndex) const;
+	virtual std::size_t priv_getNumberOfVertices() const final override;
 	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
 };
 
@@ -192,7 +231,7 @@ template <>
 class Basic<Selection::Basic::Parallelogram> : public PlainSymbol
 {
 public:
-	Basic() : PlainSymbol(sf::PrimitiveType::TriangleStrip), m_skew{ 0.1f } { }
+	Basic() : PlainSymbol(sf::PrimitiveType::TriangleStrip), m_skew{ 0.1f } { priv_setSizeIndependent(true); }
 
 	void setSkew(float skew) { m_skew = skew; priv_update(); }
 	float getSkew() const { return m_skew; }
@@ -204,21 +243,54 @@ private:
 	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
 };
 
+template <>
+class Basic<Selection::Basic::Pie> : public priv::SweptBasic
+{
+public:
+	Basic() : priv::SweptBasic(sf::PrimitiveType::TriangleFan, sf::degrees(90.f)) { priv_setSizeIndependent(true); }
 
+private:
+	virtual std::size_t priv_getNumberOfVertices() const final override { return generator::getNumberOfPieVertices(m_numberOfEdges, m_sweepRadians); }
+	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
+	virtual std::size_t priv_getFirstVertexOfSweepPoint(std::size_t pointIndex) const final override { return generator::getFirstPieVertexOfSweepPoint(pointIndex); }
+};
 
+// inner radius is a ratio of the outer radius
+template <>
+class Basic<Selection::Basic::Ring> : public priv::SweptBasic
+{
+public:
+	Basic() : priv::SweptBasic(sf::PrimitiveType::TriangleStrip, sf::degrees(360.f)), m_innerRadius{ 0.5f } { priv_setSizeIndependent(true); }
 
+	void setInnerRadius(float innerRadius) { m_innerRadius = innerRadius; priv_updateRange({ 1u, VertexRange::all, 2u }); } // inner vertices
+	float getInnerRadius() const { return m_innerRadius; }
 
+private:
+	float m_innerRadius;
 
+	virtual std::size_t priv_getNumberOfVertices() const final override { return generator::getNumberOfRingVertices(m_numberOfEdges, m_sweepRadians); }
+	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
+	virtual std::size_t priv_getFirstVertexOfSweepPoint(std::size_t pointIndex) const final override { return generator::getFirstRingVertexOfSweepPoint(pointIndex); }
+};
 
+// a ring segment with its thickness in pixels
+template <>
+class Basic<Selection::Basic::Arc> : public priv::SweptBasic
+{
+public:
+	Basic() : priv::SweptBasic(sf::PrimitiveType::TriangleStrip, sf::degrees(90.f)), m_thickness(10.f) { priv_setSizeIndependent(true); }
 
+	void setThickness(float thickness) { m_thickness = thickness; priv_updateRange(priv_getSizeDependentVertices()); }
+	float getThickness() const { return m_thickness; }
 
+private:
+	float m_thickness;
 
-
-
-
-
-
-
+	virtual std::size_t priv_getNumberOfVertices() const final override { return generator::getNumberOfRingVertices(m_numberOfEdges, m_sweepRadians); }
+	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
+	virtual std::size_t priv_getFirstVertexOfSweepPoint(std::size_t pointIndex) const final override { return generator::getFirstRingVertexOfSweepPoint(pointIndex); }
+	virtual VertexRange priv_getSizeDependentVertices() const final override { return{ 1u, VertexRange::all, 2u }; } // inner vertices
+};
 
 
 
@@ -230,49 +302,17 @@ private:
 
 sf::Vector2f Basic<Selection::Basic::Rectangle>::priv_getVertexPosition(const std::size_t vertexIndex) const
 {
-	switch (vertexIndex)
-	{
-	case 1u:
-		return{ 1.f, 0.f };
-	case 2u:
-		return{ 0.f, 1.f };
-	case 3u:
-		return{ 1.f, 1.f };
-	case 0u:
-	default:
-		return{ 0.f, 0.f };
-	}
+	return generator::getRectangleVertexPosition(vertexIndex);
 }
 
 sf::Vector2f Basic<Selection::Basic::Ellipse>::priv_getVertexPosition(const std::size_t vertexIndex) const
 {
-	const sf::Vector2f center{ 0.5f, 0.5f };
-
-	if (vertexIndex == 0u)
-		return center;
-	const std::size_t numberOfVerticesAroundPerimeter{ priv_getNumberOfVertices() - 2 };
-	if (vertexIndex <= numberOfVerticesAroundPerimeter)
-	{
-		const float radians{ 2.f * constants::pi * (vertexIndex - 1) / numberOfVerticesAroundPerimeter };
-		return{ center.x + center.x * std::cos(radians), center.y + center.y * std::sin(radians) };
-	}
-
-	return{ 1.f, center.y };
+	return generator::getEllipseVertexPosition(priv_getNumberOfVertices() - 2u, vertexIndex);
 }
 
 sf::Vector2f Basic<Selection::Basic::Star>::priv_getVertexPosition(const std::size_t vertexIndex) const
 {
-	const sf::Vector2f center{ 0.5f, 0.5f };
-
-	if (vertexIndex == 0u)
-		return center;
-	const std::size_t numberOfVerticesAroundPerimeter{ priv_getNumberOfVertices() - 2 };
-	if (vertexIndex > numberOfVerticesAroundPerimeter)
-		return{ center.x, 0.f };
-
-	const float radius{ (vertexIndex % 2 == 1) ? 1.f : m_innerDistanceMultiplier };
-	const float radians{ 2.f * constants::pi * ((vertexIndex - 1.f) / numberOfVerticesAroundPerimeter + 0.25f) };
-	return{ center.x + center.x * radius * std::cos(radians), center.y - center.y * radius * std::sin(radians) };
+	return generator::getStarVertexPosition(m_numberOfSpikes, m_innerDistanceMultiplier, vertexIndex);
 }
 
 sf::Vector2f Basic<Selection::Basic::Frame>::priv_getVertexPosition(const std::size_t vertexIndex) const
@@ -338,8 +378,48 @@ sf::Vector2f Basic<Selection::Basic::RoundedRectangle>::priv_getVertexPosition(c
 	return{ x, y };
 }
 
-sf::Vector2f Basic<Selection::Basic::RoundedFrame>::priv_getVertexPosition(const std::size_t vertexIndex) const
+inline std::size_t Basic<Selection::Basic::RoundedFrame>::priv_getNumberOfOptimisedTrianglesPerCornerStep() const
+{
+	// a corner with a zero radius collapses to a single point so its triangles on that side have no area
+	const bool isOuterCornerCollapsed{ (m_outerCornerRadius.x == 0.f) || (m_outerCornerRadius.y == 0.f) };
+	const bool isInnerCornerCollapsed{ (m_innerCornerRadius.x == 0.f) || (m_innerCornerRadius.y == 0.f) };
+	return (isOuterCornerCollapsed ? 0u : 1u) + (isInnerCornerCollapsed ? 0u : 1u);
+}
+
+inline std::size_t Basic<Selection::Basic::RoundedFrame>::priv_getStripVertexIndex(const std::size_t optimisedVertexIndex) const
 {
+	const std::size_t trianglesPerStep{ priv_getNumberOfOptimisedTrianglesPerCornerStep() };
+	const std::size_t trianglesPerCorner{ m_numberOfCornerEdges * trianglesPerStep + 2u };
+	const std::size_t triangle{ optimisedVertexIndex / 3u };
+	const std::size_t corner{ triangle / trianglesPerCorner };
+	const std::size_t cornerTriangle{ triangle % trianglesPerCorner };
+	const std::size_t cornerStart{ corner * (m_numberOfCornerEdges + 1u) * 2u };
+
+	std::size_t firstStripVertex;
+	if (cornerTriangle < m_numberOfCornerEdges * trianglesPerStep)
+	{
+		// curve: outer triangle (outer, inner, next outer) and inner triangle (inner, next outer, next inner) per step
+		const std::size_t step{ cornerTriangle / trianglesPerStep };
+		const bool isInnerTriangle{ (trianglesPerStep == 2u) ? ((cornerTriangle % 2u) == 1u) : ((m_outerCornerRadius.x == 0.f) || (m_outerCornerRadius.y == 0.f)) };
+		firstStripVertex = cornerStart + step * 2u + (isInnerTriangle ? 1u : 0u);
+	}
+	else // straight side between this corner and the next
+		firstStripVertex = cornerStart + m_numberOfCornerEdges * 2u + (cornerTriangle - m_numberOfCornerEdges * trianglesPerStep);
+	return firstStripVertex + (optimisedVertexIndex % 3u);
+}
+
+inline std::size_t Basic<Selection::Basic::RoundedFrame>::priv_getNumberOfVertices() const
+{
+	if (m_topology == Topology::Optimised)
+		return (m_numberOfCornerEdges * priv_getNumberOfOptimisedTrianglesPerCornerStep() + 2u) * 4u * 3u;
+	return (m_numberOfCornerEdges + 1u) * 8u + 2u;
+}
+
+sf::Vector2f Basic<Selection::Basic::RoundedFrame>::priv_getVertexPosition(std::size_t vertexIndex) const
+{
+	if (m_topology == Topology::Optimised)
+		vertexIndex = priv_getStripVertexIndex(vertexIndex);
+
 	const sf::Vector2f size{ getSize() };
 	sf::Vector2f thickness{ m_thickness / size.x, m_thickness / size.y };
 	const sf::Vector2f outerCornerRadius{ m_outerCornerRadius.x / size.x, m_outerCornerRadius.y / size.y };
@@ -419,5 +499,37 @@ sf::Vector2f Basic<Selection::Basic::Parallelogram>::priv_getVertexPosition(cons
 	}
 }
 
+inline void priv::SweptBasic::setSweepAngle(const sf::Angle sweepAngle)
+{
+	const float sweepRadians{ sweepAngle.asRadians() };
+	const bool isSameDirection{ (m_sweepRadians < 0.f) == (sweepRadians < 0.f) };
+	const std::size_t previousNumberOfSegments{ generator::getNumberOfSweepSegments(m_numberOfEdges, m_sweepRadians) };
+	m_sweepRadians = sweepRadians;
+	if (!isSameDirection)
+	{
+		priv_update();
+		return;
+	}
+	const std::size_t numberOfSegments{ generator::getNumberOfSweepSegments(m_numberOfEdges, m_sweepRadians) };
+	priv_updateFrom(priv_getFirstVertexOfSweepPoint(std::min(previousNumberOfSegments, numberOfSegments)));
+}
+
+inline sf::Vector2f Basic<Selection::Basic::Pie>::priv_getVertexPosition(const std::size_t vertexIndex) const
+{
+	return generator::getPieVertexPosition(m_numberOfEdges, m_startRadians, m_sweepRadians, vertexIndex);
+}
+
+inline sf::Vector2f Basic<Selection::Basic::Ring>::priv_getVertexPosition(const std::size_t vertexIndex) const
+{
+	return generator::getRingVertexPosition(m_numberOfEdges, m_startRadians, m_sweepRadians, { m_innerRadius, m_innerRadius }, vertexIndex);
+}
+
+inline sf::Vector2f Basic<Selection::Basic::Arc>::priv_getVertexPosition(const std::size_t vertexIndex) const
+{
+	const sf::Vector2f size{ getSize() };
+	const sf::Vector2f innerRadius{ 1.f - 2.f * m_thickness / size.x, 1.f - 2.f * m_thickness / size.y };
+	return generator::getRingVertexPosition(m_numberOfEdges, m_startRadians, m_sweepRadians, innerRadius, vertexIndex);
+}
+
 } // namespace grambol
 #endif // GRAMBOL_BASICS_HPP
@@ -0,0 +1,260 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// CompositeSymbol
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_COMPOSITESYMBOL_HPP
+#define GRAMBOL_COMPOSITESYMBOL_HPP
+
+#include "FullSymbol.hpp"
+
+#include <algorithm>
+#include <memory>
+
+namespace grambol
+{
+
+// a symbol built from multiple parts (other symbols), all drawn together as one triangle list.
+// each part has an offset (ratio of the composite's size) and keeps its own size and transform (in pixels,
+// so parts keep their size whatever the composite's size, including zero).
+// colour index matches part index and is multiplied with the part's own colours (white by default);
+// changing a colour (or the palette's) recolours the flattened vertices without flattening the parts again.
+// after modifying parts, call update(); only parts that changed are flattened again and, while the number of
+// vertices of each changed part stays the same, only their vertices are regenerated.
+class CompositeSymbol : public FullSymbol
+{
+public:
+	CompositeSymbol() : FullSymbol(sf::PrimitiveType::Triangles, 0u), m_isFlatteningRequired{ true } { priv_setGeneratedInPixels(true); }
+	CompositeSymbol(const CompositeSymbol&) = delete;
+	CompositeSymbol& operator=(const CompositeSymbol&) = delete;
+
+	template <class T>
+	T& addPart(sf::Vector2f offset = { 0.f, 0.f });
+	void removePart(std::size_t partIndex);
+	void clearParts();
+	std::size_t getNumberOfParts() const;
+	Symbol& getPart(std::size_t partIndex);
+	const Symbol& getPart(std::size_t partIndex) const;
+	template <class T>
+	T& getPart(std::size_t partIndex) { return static_cast<T&>(getPart(partIndex)); }
+	void setPartOffset(std::size_t partIndex, sf::Vector2f offset);
+	sf::Vector2f getPartOffset(std::size_t partIndex) const;
+
+	void update();
+
+private:
+	struct Part
+	{
+		std::unique_ptr<Symbol> symbol;
+		sf::Vector2f offset;
+		std::size_t firstVertex; // span of its triangles in the flattened vertices
+		std::size_t numberOfVertices;
+		std::size_t updateCount;
+		sf::Transform transform;
+		bool isDirty;
+	};
+
+	std::vector<Part> m_parts;
+	std::vector<sf::Vertex> m_flattenedVertices;
+	bool m_isFlatteningRequired;
+
+	bool priv_isPartChanged(const Part& part) const;
+	template <class OutputIt>
+	OutputIt priv_writePart(Part& part, OutputIt output);
+	std::size_t priv_getPartIndex(std::size_t vertexIndex) const;
+
+	virtual std::size_t priv_getNumberOfVertices() const override;
+	virtual sf::Vertex priv_getVertex(std::size_t vertexIndex) const override;
+	virtual std::size_t priv_getVertexColorIndex(std::size_t vertexIndex) const override;
+	virtual bool priv_getVertexColor(std::size_t vertexIndex, sf::Color& color) const override;
+};
+
+template <class T>
+T& CompositeSymbol::addPart(const sf::Vector2f offset)
+{
+	std::unique_ptr<T> symbol{ std::make_unique<T>() };
+	T& reference{ *symbol };
+	m_parts.push_back({ std::move(symbol), offset, m_flattenedVertices.size(), 0u, 0u, sf::Transform::Identity, true });
+	m_isFlatteningRequired = true;
+	setNumberOfColors(m_parts.size());
+	setColor(m_parts.size() - 1u, sf::Color::White);
+	return reference;
+}
+
+inline void CompositeSymbol::removePart(const std::size_t partIndex)
+{
+	if (partIndex >= m_parts.size())
+		return;
+	m_parts.erase(m_parts.begin() + partIndex);
+	eraseColor(partIndex);
+	m_isFlatteningRequired = true;
+	update();
+}
+
+inline void CompositeSymbol::clearParts()
+{
+	m_parts.clear();
+	m_flattenedVertices.clear();
+	setNumberOfColors(0u);
+	m_isFlatteningRequired = true;
+	update();
+}
+
+inline std::size_t CompositeSymbol::getNumberOfParts() const
+{
+	return m_parts.size();
+}
+
+inline Symbol& CompositeSymbol::getPart(const std::size_t partIndex)
+{
+	return *m_parts[partIndex].symbol;
+}
+
+inline const Symbol& CompositeSymbol::getPart(const std::size_t partIndex) const
+{
+	return *m_parts[partIndex].symbol;
+}
+
+inline void CompositeSymbol::setPartOffset(const std::size_t partIndex, const sf::Vector2f offset)
+{
+	if (partIndex >= m_parts.size())
+		return;
+	Part& part{ m_parts[partIndex] };
+	part.offset = offset;
+	if (m_isFlatteningRequired)
+		priv_update();
+	else
+		priv_updateRange({ part.firstVertex, part.numberOfVertices });
+}
+
+inline sf::Vector2f CompositeSymbol::getPartOffset(const std::size_t partIndex) const
+{
+	if (partIndex >= m_parts.size())
+		return{ 0.f, 0.f };
+	return m_parts[partIndex].offset;
+}
+
+inline void CompositeSymbol::update()
+{
+	// a changed part that keeps its number of vertices is written over its own span
+	std::vector<VertexRange> changedRanges;
+	for (std::size_t partIndex{ 0u }; (partIndex < m_parts.size()) && !m_isFlatteningRequired; ++partIndex)
+	{
+		Part& part{ m_parts[partIndex] };
+		if (!priv_isPartChanged(part))
+			continue;
+		const Symbol& symbol{ *part.symbol };
+		if (priv::getNumberOfTriangleVertices(symbol.priv_getOutputVertices().size(), symbol.priv_getOutputPrimitiveType()) != part.numberOfVertices)
+		{
+			m_isFlatteningRequired = true;
+			break;
+		}
+		priv_writePart(part, m_flattenedVertices.begin() + part.firstVertex);
+		changedRanges.push_back({ part.firstVertex, part.numberOfVertices });
+	}
+	if (!m_isFlatteningRequired)
+	{
+		if (!changedRanges.empty())
+			priv_updateRanges(changedRanges.data(), changedRanges.size());
+		return;
+	}
+
+	// otherwise the spans are laid out again: changed parts are written and the others copied from their previous span
+	std::vector<sf::Vertex> flattenedVertices;
+	for (auto& part : m_parts)
+	{
+		const std::size_t firstVertex{ flattenedVertices.size() };
+		if (priv_isPartChanged(part))
+			priv_writePart(part, std::back_inserter(flattenedVertices));
+		else
+			flattenedVertices.insert(flattenedVertices.end(), m_flattenedVertices.begin() + part.firstVertex, m_flattenedVertices.begin() + part.firstVertex + part.numberOfVertices);
+		part.firstVertex = firstVertex;
+		part.numberOfVertices = flattenedVertices.size() - firstVertex;
+	}
+	m_flattenedVertices.swap(flattenedVertices);
+	m_isFlatteningRequired = false;
+	priv_update();
+}
+
+inline bool CompositeSymbol::priv_isPartChanged(const Part& part) const
+{
+	const Symbol& symbol{ *part.symbol };
+	return part.isDirty || (part.updateCount != symbol.m_updateCount) || (part.transform != symbol.getTransform() * symbol.priv_getLocalTransform());
+}
+
+template <class OutputIt>
+OutputIt CompositeSymbol::priv_writePart(Part& part, OutputIt output)
+{
+	const Symbol& symbol{ *part.symbol };
+	part.transform = symbol.getTransform() * symbol.priv_getLocalTransform();
+	part.updateCount = symbol.m_updateCount;
+	part.isDirty = false;
+	return priv::writeAsTriangles(output, symbol.priv_getOutputVertices(), symbol.priv_getOutputPrimitiveType(), part.transform);
+}
+
+// the part whose span holds the vertex (an empty part shares its first vertex with the next part, which holds it)
+inline std::size_t CompositeSymbol::priv_getPartIndex(const std::size_t vertexIndex) const
+{
+	const auto it{ std::upper_bound(m_parts.begin(), m_parts.end(), vertexIndex, [](const std::size_t index, const Part& part) { return index < part.firstVertex; }) };
+	return static_cast<std::size_t>(it - m_parts.begin()) - 1u;
+}
+
+inline std::size_t CompositeSymbol::priv_getNumberOfVertices() const
+{
+	return m_flattenedVertices.size();
+}
+
+inline sf::Vertex CompositeSymbol::priv_getVertex(const std::size_t vertexIndex) const
+{
+	const std::size_t partIndex{ priv_getPartIndex(vertexIndex) };
+	const sf::Vector2f size{ getSize() };
+	sf::Vertex vertex{ m_flattenedVertices[vertexIndex] };
+	vertex.position.x += m_parts[partIndex].offset.x * size.x;
+	vertex.position.y += m_parts[partIndex].offset.y * size.y;
+	vertex.color = vertex.color * getColor(partIndex);
+	return vertex;
+}
+
+inline std::size_t CompositeSymbol::priv_getVertexColorIndex(const std::size_t vertexIndex) const
+{
+	return priv_getPartIndex(vertexIndex);
+}
+
+// the part's colour is multiplied with the flattened vertex's own colour rather than replacing it
+inline bool CompositeSymbol::priv_getVertexColor(const std::size_t vertexIndex, sf::Color& color) const
+{
+	if (vertexIndex >= m_flattenedVertices.size())
+		return false;
+	color = m_flattenedVertices[vertexIndex].color * getColor(priv_getPartIndex(vertexIndex));
+	return true;
+}
+
+} // namespace grambol
+#endif // GRAMBOL_COMPOSITESYMBOL_HPP
@@ -0,0 +1,265 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// DistanceField
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_DISTANCEFIELD_HPP
+#define GRAMBOL_DISTANCEFIELD_HPP
+
+#include "Symbol.hpp"
+#include "Geometry.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+namespace grambol
+{
+
+// signed distances (in pixels of the symbol's local space; positive inside) from the symbol's generated geometry.
+// the field covers the symbol's local bounds extended by padding on every side, sampled at the centre of each texel,
+// row by row (resolution.x values per row). rows are shared between threads (zero uses the hardware concurrency).
+// this only uses the CPU so it can be used without a window or graphics context.
+std::vector<float> generateDistanceField(const Symbol& symbol, sf::Vector2u resolution, float padding, unsigned int numberOfThreads = 0u);
+
+// converts signed distances to an image: white, with the distance in alpha (the edge at one half and
+// alpha reaching zero/one at spread outside/inside the edge).
+sf::Image createDistanceFieldImage(const std::vector<float>& distances, sf::Vector2u resolution, float spread);
+
+namespace priv
+{
+
+inline float getDistanceToEdge(const sf::Vector2f point, const geometry::Edge& edge)
+{
+	const sf::Vector2f line{ edge.end - edge.start };
+	const sf::Vector2f offset{ point - edge.start };
+	const float lengthSquared{ line.x * line.x + line.y * line.y };
+	const float ratio{ (lengthSquared > 0.f) ? std::max(0.f, std::min(1.f, (offset.x * line.x + offset.y * line.y) / lengthSquared)) : 0.f };
+	const sf::Vector2f difference{ offset - line * ratio };
+	return std::sqrt(difference.x * difference.x + difference.y * difference.y);
+}
+
+inline const char* getDistanceFieldShaderSource()
+{
+	return
+		"uniform sampler2D texture;"
+		"void main()"
+		"{"
+		"	float distance = texture2D(texture, gl_TexCoord[0].xy).a;"
+		"	float width = fwidth(distance);"
+		"	float alpha = smoothstep(0.5 - width, 0.5 + width, distance);"
+		"	gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);"
+		"}";
+}
+
+} // namespace priv
+
+inline std::vector<float> generateDistanceField(const Symbol& symbol, const sf::Vector2u resolution, const float padding, unsigned int numberOfThreads)
+{
+	GRAMBOL_INSTRUMENTATION_SCOPED_TIMER("generateDistanceField");
+	std::vector<sf::Vertex> triangles;
+	priv::appendAsTriangles(triangles, symbol);
+	const sf::Vector2f size{ symbol.getSize() };
+	const std::vector<geometry::Edge> edges{ geometry::getBoundaryEdges(triangles, std::max(size.x, size.y) * 0.0001f) };
+
+	std::vector<float> distances(static_cast<std::size_t>(resolution.x) * resolution.y, -padding);
+	if ((resolution.x == 0u) || (resolution.y == 0u) || edges.empty())
+		return distances;
+
+	const sf::Vector2f fieldSize{ size.x + padding * 2.f, size.y + padding * 2.f };
+	const sf::Vector2f texelSize{ fieldSize.x / resolution.x, fieldSize.y / resolution.y };
+	auto generateRows = [&](const unsigned int firstRow, const unsigned int rowStep)
+	{
+		for (unsigned int y{ firstRow }; y < resolution.y; y += rowStep)
+		{
+			for (unsigned int x{ 0u }; x < resolution.x; ++x)
+			{
+				const sf::Vector2f point{ -padding + (x + 0.5f) * texelSize.x, -padding + (y + 0.5f) * texelSize.y };
+				float distance{ fieldSize.x + fieldSize.y };
+				for (auto& edge : edges)
+					distance = std::min(distance, priv::getDistanceToEdge(point, edge));
+				distances[static_cast<std::size_t>(y) * resolution.x + x] = geometry::isInsideTriangles(point, triangles) ? distance : -distance;
+			}
+		}
+	};
+
+	if (numberOfThreads == 0u)
+		numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+	numberOfThreads = std::min(numberOfThreads, resolution.y);
+	std::vector<std::thread> threads;
+	for (unsigned int i{ 1u }; i < numberOfThreads; ++i)
+		threads.emplace_back(generateRows, i, numberOfThreads);
+	generateRows(0u, numberOfThreads);
+	for (auto& thread : threads)
+		thread.join();
+	return distances;
+}
+
+inline sf::Image createDistanceFieldImage(const std::vector<float>& distances, const sf::Vector2u resolution, const float spread)
+{
+	sf::Image image{ resolution, sf::Color::Transparent };
+	for (unsigned int y{ 0u }; y < resolution.y; ++y)
+	{
+		for (unsigned int x{ 0u }; x < resolution.x; ++x)
+		{
+			const float distance{ distances[static_cast<std::size_t>(y) * resolution.x + x] };
+			const float value{ (spread > 0.f) ? std::max(0.f, std::min(1.f, 0.5f + distance / (spread * 2.f))) : ((distance >= 0.f) ? 1.f : 0.f) };
+			image.setPixel({ x, y }, { 255u, 255u, 255u, static_cast<std::uint8_t>(value * 255.f + 0.5f) });
+		}
+	}
+	return image;
+}
+
+// draws a symbol from a distance field as a single textured quad so that it stays sharp at any scale.
+// with shaders available, the edge is reconstructed per pixel; without, the field's alpha is drawn directly (softer).
+// the shader is created on first draw and shared with copies, so it is released along with the symbols that use it.
+class DistanceFieldSymbol : public sf::Drawable, public sf::Transformable
+{
+public:
+	DistanceFieldSymbol();
+
+	// generates the field from the symbol's current geometry (its transform is not used)
+	bool create(const Symbol& symbol, sf::Vector2u resolution, float spread = 8.f, unsigned int numberOfThreads = 0u);
+
+	void setSize(sf::Vector2f size); // size of the symbol's bounds (not including the field's padding)
+	sf::Vector2f getSize() const;
+	void setColor(sf::Color color);
+	sf::Color getColor() const;
+	const sf::Texture& getTexture() const;
+
+private:
+	sf::Texture m_texture;
+	sf::Vector2f m_size;
+	sf::Vector2f m_paddingRatio; // padding as a ratio of the symbol's size
+	sf::Color m_color;
+	sf::Vertex m_quad[4u];
+	mutable std::shared_ptr<sf::Shader> m_shader;
+	mutable bool m_isShaderRequested;
+
+	const sf::Shader* priv_getShader() const;
+	void priv_updateQuad();
+	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
+
+inline DistanceFieldSymbol::DistanceFieldSymbol()
+	: m_texture()
+	, m_size{ 0.f, 0.f }
+	, m_paddingRatio{ 0.f, 0.f }
+	, m_color{ sf::Color::Black }
+	, m_quad()
+	, m_shader()
+	, m_isShaderRequested{ false }
+{
+}
+
+inline bool DistanceFieldSymbol::create(const Symbol& symbol, const sf::Vector2u resolution, const float spread, const unsigned int numberOfThreads)
+{
+	const sf::Vector2f symbolSize{ symbol.getSize() };
+	if ((symbolSize.x <= 0.f) || (symbolSize.y <= 0.f) || (resolution.x == 0u) || (resolution.y == 0u))
+		return false;
+	const std::vector<float> distances{ generateDistanceField(symbol, resolution, spread, numberOfThreads) };
+	if (!m_texture.loadFromImage(createDistanceFieldImage(distances, resolution, spread)))
+		return false;
+	m_texture.setSmooth(true);
+	m_paddingRatio = { spread / symbolSize.x, spread / symbolSize.y };
+	if ((m_size.x == 0.f) && (m_size.y == 0.f))
+		m_size = symbolSize;
+	priv_updateQuad();
+	return true;
+}
+
+inline void DistanceFieldSymbol::setSize(const sf::Vector2f size)
+{
+	m_size = size;
+	priv_updateQuad();
+}
+
+inline sf::Vector2f DistanceFieldSymbol::getSize() const
+{
+	return m_size;
+}
+
+inline void DistanceFieldSymbol::setColor(const sf::Color color)
+{
+	m_color = color;
+	priv_updateQuad();
+}
+
+inline sf::Color DistanceFieldSymbol::getColor() const
+{
+	return m_color;
+}
+
+inline const sf::Texture& DistanceFieldSymbol::getTexture() const
+{
+	return m_texture;
+}
+
+// loads the shader once (when first drawn, so that a graphics context exists); null if shaders are not available
+inline const sf::Shader* DistanceFieldSymbol::priv_getShader() const
+{
+	if (m_isShaderRequested)
+		return m_shader.get();
+	m_isShaderRequested = true;
+	if (!sf::Shader::isAvailable())
+		return nullptr;
+	std::shared_ptr<sf::Shader> shader{ std::make_shared<sf::Shader>() };
+	if (!shader->loadFromMemory(priv::getDistanceFieldShaderSource(), sf::Shader::Type::Fragment))
+		return nullptr;
+	shader->setUniform("texture", sf::Shader::CurrentTexture);
+	m_shader = std::move(shader);
+	return m_shader.get();
+}
+
+inline void DistanceFieldSymbol::priv_updateQuad()
+{
+	const sf::Vector2f padding{ m_size.x * m_paddingRatio.x, m_size.y * m_paddingRatio.y };
+	const sf::Vector2f topLeft{ -padding };
+	const sf::Vector2f bottomRight{ m_size + padding };
+	const sf::Vector2f textureSize{ m_texture.getSize() };
+	m_quad[0u] = { topLeft, m_color, { 0.f, 0.f } };
+	m_quad[1u] = { { bottomRight.x, topLeft.y }, m_color, { textureSize.x, 0.f } };
+	m_quad[2u] = { { topLeft.x, bottomRight.y }, m_color, { 0.f, textureSize.y } };
+	m_quad[3u] = { bottomRight, m_color, textureSize };
+}
+
+inline void DistanceFieldSymbol::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	GRAMBOL_INSTRUMENTATION_RECORD_DRAW(typeid(*this), 4u);
+	states.transform *= getTransform();
+	states.texture = &m_texture;
+	states.shader = priv_getShader();
+	priv::submitDraw(target, m_quad, 4u, sf::PrimitiveType::TriangleStrip, states);
+}
+
+} // namespace grambol
+#endif // GRAMBOL_DISTANCEFIELD_HPP
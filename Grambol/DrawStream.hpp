@@ -0,0 +1,361 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// DrawStream
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_DRAWSTREAM_HPP
+#define GRAMBOL_DRAWSTREAM_HPP
+
+#include "Symbol.hpp"
+#include "DrawSubmission.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+namespace grambol
+{
+
+// a render target stand-in that needs no window (or graphics context): draws made to it by Grambol's drawables are written
+// to a compact binary trace instead of being drawn so that real frames can be captured and replayed anywhere with replayDrawStream().
+// only Grambol's drawables can be drawn to it; SFML's own drawing (including clear()) must not be used on it.
+// each draw stores its primitive type, vertices, transform, blend mode and texture (as an id; 0 is none) in the host's byte order.
+class DrawRecorder : public sf::RenderTarget, private priv::DrawSink
+{
+public:
+	explicit DrawRecorder(std::ostream& stream, sf::Vector2u size = { 800u, 600u });
+	~DrawRecorder();
+	DrawRecorder(const DrawRecorder&) = delete;
+	DrawRecorder& operator=(const DrawRecorder&) = delete;
+
+	virtual sf::Vector2u getSize() const override;
+
+	void endFrame();
+	bool isGood() const; // false once writing to the stream has failed
+	std::size_t getNumberOfFrames() const;
+	std::size_t getNumberOfDrawCalls() const;
+	std::size_t getNumberOfVertices() const;
+	std::size_t getNumberOfBytesWritten() const;
+
+private:
+	std::ostream& m_stream;
+	sf::Vector2u m_size;
+	std::map<const sf::Texture*, std::uint32_t> m_textureIds;
+	std::vector<char> m_buffer;
+	std::size_t m_numberOfFrames;
+	std::size_t m_numberOfDrawCalls;
+	std::size_t m_numberOfVertices;
+	std::size_t m_numberOfBytesWritten;
+
+	virtual void priv_onSubmitted(const sf::Vertex* vertices, std::size_t numberOfVertices, sf::PrimitiveType primitiveType, const sf::RenderStates& states) override;
+	void priv_write();
+};
+
+struct DrawStreamStatistics
+{
+	bool isValid{ false }; // false if the stream is not a draw stream or ends part-way through a record
+	std::size_t numberOfFrames{ 0u };
+	std::size_t numberOfDrawCalls{ 0u }; // as recorded
+	std::size_t numberOfBatchedDrawCalls{ 0u }; // after joining consecutive draws that share a texture and blend mode
+	std::size_t numberOfVertices{ 0u }; // as recorded
+	std::size_t numberOfBatchedVertices{ 0u };
+	std::size_t numberOfBytesRead{ 0u };
+	std::size_t numberOfBytesMoved{ 0u }; // batched vertex data that would be submitted
+	sf::Time duration;
+
+	double getVerticesPerSecond() const; // recorded vertices through the batching
+};
+
+// replays a trace written by a DrawRecorder through the same CPU batching as SymbolBatch: consecutive draws that share a texture and
+// blend mode are transformed into one triangle list. if a target is given, the batches are also drawn to it (without textures, as the trace
+// does not store them). points and lines are passed through as their own draws.
+DrawStreamStatistics replayDrawStream(std::istream& stream, sf::RenderTarget* target = nullptr);
+
+namespace priv
+{
+
+constexpr char drawStreamMagic[4u]{ 'G', 'R', 'D', 'S' };
+constexpr std::uint32_t drawStreamVersion{ 1u };
+constexpr std::uint8_t drawStreamDrawTag{ 1u };
+constexpr std::uint8_t drawStreamFrameTag{ 2u };
+constexpr std::size_t drawStreamVertexSize{ 20u }; // position, colour and texture co-ordinates
+constexpr std::size_t drawStreamMaximumVertices{ 1u << 24u }; // per draw; larger counts are treated as corruption
+constexpr std::size_t drawStreamDrawHeaderSize{ 1u + 4u + 9u * 4u + 6u + 4u }; // primitive type, number of vertices, transform, blend mode, texture id
+
+template <class T>
+void appendBytes(std::vector<char>& buffer, const T& value)
+{
+	const char* const bytes{ reinterpret_cast<const char*>(&value) };
+	buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template <class T>
+T readBytes(const char*& bytes)
+{
+	T value;
+	std::memcpy(&value, bytes, sizeof(T));
+	bytes += sizeof(T);
+	return value;
+}
+
+} // namespace priv
+
+inline DrawRecorder::DrawRecorder(std::ostream& stream, const sf::Vector2u size)
+	: m_stream(stream)
+	, m_size{ size }
+	, m_textureIds()
+	, m_buffer()
+	, m_numberOfFrames{ 0u }
+	, m_numberOfDrawCalls{ 0u }
+	, m_numberOfVertices{ 0u }
+	, m_numberOfBytesWritten{ 0u }
+{
+	priv::registerDrawSink(*this, *this);
+	m_buffer.insert(m_buffer.end(), priv::drawStreamMagic, priv::drawStreamMagic + 4u);
+	priv::appendBytes(m_buffer, priv::drawStreamVersion);
+	priv_write();
+}
+
+inline DrawRecorder::~DrawRecorder()
+{
+	priv::unregisterDrawSink(*this);
+	m_stream.flush();
+}
+
+inline sf::Vector2u DrawRecorder::getSize() const
+{
+	return m_size;
+}
+
+inline void DrawRecorder::endFrame()
+{
+	m_buffer.push_back(static_cast<char>(priv::drawStreamFrameTag));
+	priv_write();
+	++m_numberOfFrames;
+}
+
+inline bool DrawRecorder::isGood() const
+{
+	return m_stream.good();
+}
+
+inline std::size_t DrawRecorder::getNumberOfFrames() const
+{
+	return m_numberOfFrames;
+}
+
+inline std::size_t DrawRecorder::getNumberOfDrawCalls() const
+{
+	return m_numberOfDrawCalls;
+}
+
+inline std::size_t DrawRecorder::getNumberOfVertices() const
+{
+	return m_numberOfVertices;
+}
+
+inline std::size_t DrawRecorder::getNumberOfBytesWritten() const
+{
+	return m_numberOfBytesWritten;
+}
+
+inline void DrawRecorder::priv_onSubmitted(const sf::Vertex* const vertices, const std::size_t numberOfVertices, const sf::PrimitiveType primitiveType, const sf::RenderStates& states)
+{
+	std::uint32_t textureId{ 0u };
+	if (states.texture != nullptr)
+		textureId = m_textureIds.emplace(states.texture, static_cast<std::uint32_t>(m_textureIds.size() + 1u)).first->second;
+
+	const float* const matrix{ states.transform.getMatrix() };
+	const sf::BlendMode& blendMode{ states.blendMode };
+	m_buffer.reserve(1u + priv::drawStreamDrawHeaderSize + numberOfVertices * priv::drawStreamVertexSize);
+	m_buffer.push_back(static_cast<char>(priv::drawStreamDrawTag));
+	priv::appendBytes(m_buffer, static_cast<std::uint8_t>(primitiveType));
+	priv::appendBytes(m_buffer, static_cast<std::uint32_t>(numberOfVertices));
+	for (const std::size_t i : { 0u, 4u, 12u, 1u, 5u, 13u, 3u, 7u, 15u }) // the 3x3 matrix (row by row) within sfml's 4x4 one
+		priv::appendBytes(m_buffer, matrix[i]);
+	for (const auto factor : { blendMode.colorSrcFactor, blendMode.colorDstFactor, blendMode.alphaSrcFactor, blendMode.alphaDstFactor })
+		priv::appendBytes(m_buffer, static_cast<std::uint8_t>(factor));
+	for (const auto equation : { blendMode.colorEquation, blendMode.alphaEquation })
+		priv::appendBytes(m_buffer, static_cast<std::uint8_t>(equation));
+	priv::appendBytes(m_buffer, textureId);
+	for (std::size_t i{ 0u }; i < numberOfVertices; ++i)
+	{
+		const sf::Vertex& vertex{ vertices[i] };
+		priv::appendBytes(m_buffer, vertex.position.x);
+		priv::appendBytes(m_buffer, vertex.position.y);
+		m_buffer.insert(m_buffer.end(), { static_cast<char>(vertex.color.r), static_cast<char>(vertex.color.g), static_cast<char>(vertex.color.b), static_cast<char>(vertex.color.a) });
+		priv::appendBytes(m_buffer, vertex.texCoords.x);
+		priv::appendBytes(m_buffer, vertex.texCoords.y);
+	}
+	priv_write();
+	++m_numberOfDrawCalls;
+	m_numberOfVertices += numberOfVertices;
+}
+
+inline void DrawRecorder::priv_write()
+{
+	m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+	m_numberOfBytesWritten += m_buffer.size();
+	m_buffer.clear();
+}
+
+inline double DrawStreamStatistics::getVerticesPerSecond() const
+{
+	const double seconds{ static_cast<double>(duration.asMicroseconds()) / 1000000.0 };
+	return (seconds > 0.0) ? static_cast<double>(numberOfVertices) / seconds : 0.0;
+}
+
+inline DrawStreamStatistics replayDrawStream(std::istream& stream, sf::RenderTarget* const target)
+{
+	DrawStreamStatistics statistics;
+	sf::Clock clock;
+	std::vector<char> bytes(8u);
+	auto read = [&](const std::size_t numberOfBytes)
+	{
+		bytes.resize(numberOfBytes);
+		stream.read(bytes.data(), static_cast<std::streamsize>(numberOfBytes));
+		statistics.numberOfBytesRead += static_cast<std::size_t>(stream.gcount());
+		return static_cast<std::size_t>(stream.gcount()) == numberOfBytes;
+	};
+
+	// the number of vertices a record claims must fit in what is left of the stream (when its size can be found)
+	std::size_t streamSize{ static_cast<std::size_t>(-1) };
+	const std::istream::pos_type start{ stream.tellg() };
+	if (start != std::istream::pos_type(-1))
+	{
+		if (stream.seekg(0, std::ios::end))
+			streamSize = static_cast<std::size_t>(stream.tellg() - start);
+		stream.clear();
+		stream.seekg(start);
+	}
+
+	if (!read(8u) || (std::memcmp(bytes.data(), priv::drawStreamMagic, 4u) != 0))
+		return statistics;
+	const char* header{ bytes.data() + 4u };
+	if (priv::readBytes<std::uint32_t>(header) != priv::drawStreamVersion)
+		return statistics;
+
+	std::vector<sf::Vertex> vertices;
+	std::vector<sf::Vertex> batch;
+	sf::BlendMode batchBlendMode;
+	std::uint32_t batchTextureId{ 0u };
+	auto flush = [&]()
+	{
+		if (batch.empty())
+			return;
+		++statistics.numberOfBatchedDrawCalls;
+		statistics.numberOfBatchedVertices += batch.size();
+		statistics.numberOfBytesMoved += batch.size() * sizeof(sf::Vertex);
+		if (target != nullptr)
+			target->draw(batch.data(), batch.size(), sf::PrimitiveType::Triangles, sf::RenderStates(batchBlendMode));
+		batch.clear();
+	};
+
+	char tag;
+	while (stream.get(tag))
+	{
+		++statistics.numberOfBytesRead;
+		if (static_cast<std::uint8_t>(tag) == priv::drawStreamFrameTag)
+		{
+			flush();
+			++statistics.numberOfFrames;
+			continue;
+		}
+		if ((static_cast<std::uint8_t>(tag) != priv::drawStreamDrawTag) || !read(priv::drawStreamDrawHeaderSize))
+			return statistics;
+
+		const char* data{ bytes.data() };
+		const sf::PrimitiveType primitiveType{ static_cast<sf::PrimitiveType>(priv::readBytes<std::uint8_t>(data)) };
+		const std::size_t numberOfVertices{ priv::readBytes<std::uint32_t>(data) };
+		float matrix[9u];
+		for (float& element : matrix)
+			element = priv::readBytes<float>(data);
+		const sf::Transform transform{ matrix[0u], matrix[1u], matrix[2u], matrix[3u], matrix[4u], matrix[5u], matrix[6u], matrix[7u], matrix[8u] };
+		sf::BlendMode blendMode;
+		blendMode.colorSrcFactor = static_cast<sf::BlendMode::Factor>(priv::readBytes<std::uint8_t>(data));
+		blendMode.colorDstFactor = static_cast<sf::BlendMode::Factor>(priv::readBytes<std::uint8_t>(data));
+		blendMode.alphaSrcFactor = static_cast<sf::BlendMode::Factor>(priv::readBytes<std::uint8_t>(data));
+		blendMode.alphaDstFactor = static_cast<sf::BlendMode::Factor>(priv::readBytes<std::uint8_t>(data));
+		blendMode.colorEquation = static_cast<sf::BlendMode::Equation>(priv::readBytes<std::uint8_t>(data));
+		blendMode.alphaEquation = static_cast<sf::BlendMode::Equation>(priv::readBytes<std::uint8_t>(data));
+		const std::uint32_t textureId{ priv::readBytes<std::uint32_t>(data) };
+
+		const std::size_t numberOfVertexBytes{ numberOfVertices * priv::drawStreamVertexSize };
+		if ((numberOfVertices > priv::drawStreamMaximumVertices) || (numberOfVertexBytes > streamSize - statistics.numberOfBytesRead) || !read(numberOfVertexBytes))
+			return statistics;
+		data = bytes.data();
+		vertices.resize(numberOfVertices);
+		for (auto& vertex : vertices)
+		{
+			vertex.position.x = priv::readBytes<float>(data);
+			vertex.position.y = priv::readBytes<float>(data);
+			vertex.color = { priv::readBytes<std::uint8_t>(data), priv::readBytes<std::uint8_t>(data), priv::readBytes<std::uint8_t>(data), priv::readBytes<std::uint8_t>(data) };
+			vertex.texCoords.x = priv::readBytes<float>(data);
+			vertex.texCoords.y = priv::readBytes<float>(data);
+		}
+		++statistics.numberOfDrawCalls;
+		statistics.numberOfVertices += numberOfVertices;
+
+		if ((textureId != batchTextureId) || (blendMode != batchBlendMode))
+		{
+			flush();
+			batchTextureId = textureId;
+			batchBlendMode = blendMode;
+		}
+		const bool isTriangles{ (primitiveType == sf::PrimitiveType::Triangles) || (primitiveType == sf::PrimitiveType::TriangleStrip) || (primitiveType == sf::PrimitiveType::TriangleFan) };
+		if (isTriangles)
+		{
+			priv::appendAsTriangles(batch, vertices, primitiveType, transform);
+			continue;
+		}
+		flush();
+		++statistics.numberOfBatchedDrawCalls;
+		statistics.numberOfBatchedVertices += numberOfVertices;
+		statistics.numberOfBytesMoved += numberOfVertices * sizeof(sf::Vertex);
+		if (target != nullptr)
+		{
+			sf::RenderStates states{ blendMode };
+			states.transform = transform;
+			target->draw(vertices.data(), numberOfVertices, primitiveType, states);
+		}
+	}
+	flush();
+	statistics.duration = clock.getElapsedTime();
+	statistics.isValid = true;
+	return statistics;
+}
+
+} // namespace grambol
+#endif // GRAMBOL_DRAWSTREAM_HPP
@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// DrawSubmission
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_DRAWSUBMISSION_HPP
+#define GRAMBOL_DRAWSUBMISSION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+
+namespace grambol
+{
+namespace priv
+{
+
+// implemented by DrawRecorder; receives the draws submitted to the render target it is registered for instead of that target
+class DrawSink
+{
+public:
+	virtual void priv_onSubmitted(const sf::Vertex* vertices, std::size_t numberOfVertices, sf::PrimitiveType primitiveType, const sf::RenderStates& states) = 0;
+
+protected:
+	~DrawSink() = default;
+};
+
+// render targets whose draws are captured (usually none, so submitting only checks an empty list). not thread-safe.
+inline std::vector<std::pair<const sf::RenderTarget*, DrawSink*>>& getDrawSinks()
+{
+	static std::vector<std::pair<const sf::RenderTarget*, DrawSink*>> sinks;
+	return sinks;
+}
+
+inline void registerDrawSink(const sf::RenderTarget& target, DrawSink& sink)
+{
+	getDrawSinks().emplace_back(&target, &sink);
+}
+
+inline void unregisterDrawSink(const DrawSink& sink)
+{
+	auto& sinks{ getDrawSinks() };
+	sinks.erase(std::remove_if(sinks.begin(), sinks.end(), [&sink](const std::pair<const sf::RenderTarget*, DrawSink*>& entry) { return entry.second == &sink; }), sinks.end());
+}
+
+inline DrawSink* findDrawSink(const sf::RenderTarget& target)
+{
+	for (auto& entry : getDrawSinks())
+	{
+		if (entry.first == &target)
+			return entry.second;
+	}
+	return nullptr;
+}
+
+// every draw made by Grambol's drawables goes through here so that it can be captured
+inline void submitDraw(sf::RenderTarget& target, const sf::Vertex* const vertices, const std::size_t numberOfVertices, const sf::PrimitiveType primitiveType, const sf::RenderStates& states)
+{
+	if (DrawSink* const sink{ findDrawSink(target) })
+		sink->priv_onSubmitted(vertices, numberOfVertices, primitiveType, states);
+	else
+		target.draw(vertices, numberOfVertices, primitiveType, states);
+}
+
+// a range of a vertex buffer (of triangles) along with the same vertices on the CPU, which are captured instead
+inline void submitDraw(sf::RenderTarget& target, const sf::VertexBuffer& buffer, const std::size_t first, const std::size_t numberOfVertices, const sf::Vertex* const vertices, const sf::RenderStates& states)
+{
+	if (DrawSink* const sink{ findDrawSink(target) })
+		sink->priv_onSubmitted(vertices + first, numberOfVertices, sf::PrimitiveType::Triangles, states);
+	else
+		target.draw(buffer, first, numberOfVertices, states);
+}
+
+} // namespace priv
+} // namespace grambol
+#endif // GRAMBOL_DRAWSUBMISSION_HPP
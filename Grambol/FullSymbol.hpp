@@ -33,6 +33,7 @@
 #ifndef GRAMBOL_FULLSYMBOL_HPP
 #define GRAMBOL_FULLSYMBOL_HPP
 
+#include <algorithm>
 #include <initializer_list>
 
 #include "Symbol.hpp"
@@ -40,23 +41,36 @@
 namespace grambol
 {
 
+class Palette;
+
+// colours can be the symbol's own or come from a shared palette (palette colours take priority where they exist).
+// symbols that provide a colour index for every vertex are recoloured without regenerating their geometry.
 class FullSymbol : public Symbol
 {
 public:
+	static constexpr std::size_t noColorIndex{ static_cast<std::size_t>(-1) };
+
 	FullSymbol(sf::PrimitiveType primitiveType = sf::PrimitiveType::Triangles, std::size_t numberOfColors = 1u) : Symbol(primitiveType), m_colors(numberOfColors) { }
 	FullSymbol(sf::PrimitiveType primitiveType, std::initializer_list<sf::Color> colors) : Symbol(primitiveType), m_colors{ colors } { }
-	virtual ~FullSymbol() { }
+	FullSymbol(const FullSymbol& other);
+	FullSymbol& operator=(const FullSymbol& other);
+	virtual ~FullSymbol();
 
 	std::size_t getNumberOfColors() const;
 	void setColor(std::size_t colorIndex, sf::Color color);
 	sf::Color getColor(std::size_t colorIndex) const;
 	void setColors(const std::vector<sf::Color>& colors);
 
+	void setPalette(Palette* palette);
+	Palette* getPalette() const;
+
 protected:
 	void setNumberOfColors(std::size_t numberOfColors);
+	void eraseColor(std::size_t colorIndex); // later colours move down; like setNumberOfColors, this does not recolour
 	virtual std::size_t priv_getNumberOfVertices() const = 0;
 	virtual sf::Vertex priv_getVertex(std::size_t vertexIndex) const = 0;
-
+	virtual std::size_t priv_getVertexColorIndex(std::size_t vertexIndex) const; // noColorIndex if the vertex colour is not a plain colour
+	void priv_recolor();
 
 
 
@@ -68,11 +82,52 @@ protected:
 
 
 private:
+	friend class Palette;
+
 	std::vector<sf::Color> m_colors;
+	Palette* m_palette{ nullptr };
+	std::size_t m_paletteSlot{ 0u };
+	std::vector<std::size_t> m_vertexColorIndices;
+	std::size_t m_vertexColorIndicesUpdateCount{ 0u };
+	bool m_isRecolorable{ false };
 
 	bool isValidColorIndex(std::size_t colorIndex) const;
+	void priv_attachToPalette(Palette* palette);
+	void priv_detachFromPalette();
+	virtual bool priv_getVertexColor(std::size_t vertexIndex, sf::Color& color) const override;
 };
 
+} // namespace grambol
+
+#include "Palette.hpp" // FullSymbol's members use Palette's
+
+namespace grambol
+{
+
+inline FullSymbol::FullSymbol(const FullSymbol& other)
+	: Symbol(other)
+	, m_colors(other.m_colors)
+{
+	priv_attachToPalette(other.m_palette);
+}
+
+inline FullSymbol& FullSymbol::operator=(const FullSymbol& other)
+{
+	if (this == &other)
+		return *this;
+	Symbol::operator=(other);
+	m_colors = other.m_colors;
+	m_vertexColorIndices.clear();
+	priv_detachFromPalette();
+	priv_attachToPalette(other.m_palette);
+	return *this;
+}
+
+inline FullSymbol::~FullSymbol()
+{
+	priv_detachFromPalette();
+}
+
 inline bool FullSymbol::isValidColorIndex(std::size_t colorIndex) const
 {
 	return colorIndex < m_colors.size();
@@ -83,6 +138,12 @@ inline void FullSymbol::setNumberOfColors(std::size_t numberOfColors)
 	m_colors.resize(numberOfColors);
 }
 
+inline void FullSymbol::eraseColor(const std::size_t colorIndex)
+{
+	if (isValidColorIndex(colorIndex))
+		m_colors.erase(m_colors.begin() + colorIndex);
+}
+
 inline std::size_t FullSymbol::getNumberOfColors() const
 {
 	return m_colors.size();
@@ -93,22 +154,93 @@ inline void FullSymbol::setColor(std::size_t colorIndex, sf::Color color)
 	if (!isValidColorIndex(colorIndex))
 		return;
 	m_colors[colorIndex] = color;
-	priv_update();
+	priv_recolor();
 }
 
 inline void FullSymbol::setColors(const std::vector<sf::Color>& colors)
 {
-	std::size_t index{ 0u };
-	for (auto& color : colors)
-		setColor(index++, color);
+	const std::size_t numberOfColors{ std::min(colors.size(), m_colors.size()) };
+	for (std::size_t i{ 0u }; i < numberOfColors; ++i)
+		m_colors[i] = colors[i];
+	priv_recolor();
 }
 
 inline sf::Color FullSymbol::getColor(std::size_t colorIndex) const
 {
 	if (!isValidColorIndex(colorIndex))
 		return sf::Color::Transparent;
+	if ((m_palette != nullptr) && (colorIndex < m_palette->m_colors.size()))
+		return m_palette->m_colors[colorIndex];
 	return m_colors[colorIndex];
 }
 
+inline void FullSymbol::setPalette(Palette* const palette)
+{
+	if (palette == m_palette)
+		return;
+	priv_detachFromPalette();
+	priv_attachToPalette(palette);
+	priv_recolor();
+}
+
+inline Palette* FullSymbol::getPalette() const
+{
+	return m_palette;
+}
+
+inline std::size_t FullSymbol::priv_getVertexColorIndex(std::size_t) const
+{
+	return noColorIndex;
+}
+
+inline void FullSymbol::priv_recolor()
+{
+	const std::size_t numberOfVertices{ priv_getNumberOfVertices() };
+	if ((m_vertexColorIndicesUpdateCount != priv_getUpdateCount()) || (m_vertexColorIndices.size() != numberOfVertices))
+	{
+		m_vertexColorIndices.resize(numberOfVertices);
+		m_isRecolorable = true;
+		for (std::size_t i{ 0u }; i < numberOfVertices; ++i)
+		{
+			m_vertexColorIndices[i] = priv_getVertexColorIndex(i);
+			if (m_vertexColorIndices[i] == noColorIndex)
+				m_isRecolorable = false;
+		}
+	}
+	if (m_isRecolorable)
+		priv_updateColors();
+	else
+		priv_update();
+	m_vertexColorIndicesUpdateCount = priv_getUpdateCount();
+}
+
+inline bool FullSymbol::priv_getVertexColor(const std::size_t vertexIndex, sf::Color& color) const
+{
+	if ((vertexIndex >= m_vertexColorIndices.size()) || (m_vertexColorIndices[vertexIndex] == noColorIndex))
+		return false;
+	color = getColor(m_vertexColorIndices[vertexIndex]);
+	return true;
+}
+
+inline void FullSymbol::priv_attachToPalette(Palette* const palette)
+{
+	m_palette = palette;
+	if (m_palette == nullptr)
+		return;
+	m_paletteSlot = m_palette->m_symbols.size();
+	m_palette->m_symbols.push_back(this);
+}
+
+inline void FullSymbol::priv_detachFromPalette()
+{
+	if (m_palette == nullptr)
+		return;
+	std::vector<FullSymbol*>& symbols{ m_palette->m_symbols };
+	symbols[m_paletteSlot] = symbols.back();
+	symbols[m_paletteSlot]->m_paletteSlot = m_paletteSlot;
+	symbols.pop_back();
+	m_palette = nullptr;
+}
+
 } // namespace grambol
 #endif // GRAMBOL_FULLSYMBOL_HPP
@@ -0,0 +1,225 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// Generators
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_GENERATORS_HPP
+#define GRAMBOL_GENERATORS_HPP
+
+#include "Symbol.hpp"
+
+namespace grambol
+{
+namespace generator
+{
+
+// free (non-virtual) vertex generators shared by the symbol classes and by SymbolPool.
+// positions are in normalised (0-1) space; sizes given in pixels are converted using the symbol's size.
+
+inline std::size_t getNumberOfRectangleVertices()
+{
+	return 4u;
+}
+
+inline sf::Vector2f getRectangleVertexPosition(const std::size_t vertexIndex)
+{
+	switch (vertexIndex)
+	{
+	case 1u:
+		return{ 1.f, 0.f };
+	case 2u:
+		return{ 0.f, 1.f };
+	case 3u:
+		return{ 1.f, 1.f };
+	case 0u:
+	default:
+		return{ 0.f, 0.f };
+	}
+}
+
+inline std::size_t getNumberOfEllipseVertices(const std::size_t numberOfEdges)
+{
+	return numberOfEdges + 2u;
+}
+
+inline sf::Vector2f getEllipseVertexPosition(const std::size_t numberOfEdges, const std::size_t vertexIndex)
+{
+	const sf::Vector2f center{ 0.5f, 0.5f };
+
+	if (vertexIndex == 0u)
+		return center;
+	const std::size_t numberOfVerticesAroundPerimeter{ numberOfEdges };
+	if (vertexIndex <= numberOfVerticesAroundPerimeter)
+	{
+		const float radians{ 2.f * constants::pi * (vertexIndex - 1) / numberOfVerticesAroundPerimeter };
+		return{ center.x + center.x * std::cos(radians), center.y + center.y * std::sin(radians) };
+	}
+
+	return{ 1.f, center.y };
+}
+
+inline std::size_t getNumberOfStarVertices(const std::size_t numberOfSpikes)
+{
+	return (numberOfSpikes * 2u) + 2u;
+}
+
+inline sf::Vector2f getStarVertexPosition(const std::size_t numberOfSpikes, const float innerDistanceMultiplier, const std::size_t vertexIndex)
+{
+	const sf::Vector2f center{ 0.5f, 0.5f };
+
+	if (vertexIndex == 0u)
+		return center;
+	const std::size_t numberOfVerticesAroundPerimeter{ numberOfSpikes * 2u };
+	if (vertexIndex > numberOfVerticesAroundPerimeter)
+		return{ center.x, 0.f };
+
+	const float radius{ (vertexIndex % 2 == 1) ? 1.f : innerDistanceMultiplier };
+	const float radians{ 2.f * constants::pi * ((vertexIndex - 1.f) / numberOfVerticesAroundPerimeter + 0.25f) };
+	return{ center.x + center.x * radius * std::cos(radians), center.y - center.y * radius * std::sin(radians) };
+}
+
+// swept shapes (pie, ring, arc) place points around the ellipse every full turn / numberOfEdges from the start angle, plus one at the
+// exact end of the sweep, so changing only the sweep leaves all points before the new (or old) end unchanged.
+// angles are in radians, clockwise on screen from the positive x axis; the sweep is limited to one full turn either way.
+inline std::size_t getNumberOfSweepSegments(const std::size_t numberOfEdges, const float sweepRadians)
+{
+	const float segments{ std::min(abs(sweepRadians), 2.f * constants::pi) * numberOfEdges / (2.f * constants::pi) };
+	const std::size_t numberOfSegments{ static_cast<std::size_t>(std::ceil(segments - 0.0001f)) };
+	return (numberOfSegments < 1u) ? 1u : numberOfSegments;
+}
+
+inline sf::Vector2f getSweepDirection(const std::size_t numberOfEdges, const float startRadians, const float sweepRadians, const std::size_t pointIndex)
+{
+	const float clampedSweep{ std::max(-2.f * constants::pi, std::min(2.f * constants::pi, sweepRadians)) };
+	const float radians{ (pointIndex >= getNumberOfSweepSegments(numberOfEdges, sweepRadians))
+		? startRadians + clampedSweep
+		: startRadians + ((sweepRadians < 0.f) ? -2.f : 2.f) * constants::pi * pointIndex / numberOfEdges };
+	return{ std::cos(radians), std::sin(radians) };
+}
+
+// triangle fan: centre then each point
+inline std::size_t getNumberOfPieVertices(const std::size_t numberOfEdges, const float sweepRadians)
+{
+	return getNumberOfSweepSegments(numberOfEdges, sweepRadians) + 2u;
+}
+
+inline std::size_t getFirstPieVertexOfSweepPoint(const std::size_t pointIndex)
+{
+	return pointIndex + 1u;
+}
+
+inline sf::Vector2f getPieVertexPosition(const std::size_t numberOfEdges, const float startRadians, const float sweepRadians, const std::size_t vertexIndex)
+{
+	const sf::Vector2f center{ 0.5f, 0.5f };
+	if (vertexIndex == 0u)
+		return center;
+	const sf::Vector2f direction{ getSweepDirection(numberOfEdges, startRadians, sweepRadians, vertexIndex - 1u) };
+	return{ center.x + center.x * direction.x, center.y + center.y * direction.y };
+}
+
+// triangle strip: outer then inner vertex of each point. the inner radius is a ratio of the outer radius (on each axis).
+inline std::size_t getNumberOfRingVertices(const std::size_t numberOfEdges, const float sweepRadians)
+{
+	return (getNumberOfSweepSegments(numberOfEdges, sweepRadians) + 1u) * 2u;
+}
+
+inline std::size_t getFirstRingVertexOfSweepPoint(const std::size_t pointIndex)
+{
+	return pointIndex * 2u;
+}
+
+inline sf::Vector2f getRingVertexPosition(const std::size_t numberOfEdges, const float startRadians, const float sweepRadians, const sf::Vector2f innerRadius, const std::size_t vertexIndex)
+{
+	const sf::Vector2f center{ 0.5f, 0.5f };
+	const sf::Vector2f direction{ getSweepDirection(numberOfEdges, startRadians, sweepRadians, vertexIndex / 2u) };
+	const sf::Vector2f radius{ (vertexIndex % 2u == 0u) ? sf::Vector2f{ 1.f, 1.f } : innerRadius };
+	return{ center.x + center.x * radius.x * direction.x, center.y + center.y * radius.y * direction.y };
+}
+
+inline std::size_t getNumberOfStandardArrowVertices(const bool isOptimised)
+{
+	return isOptimised ? 15u : 10u;
+}
+
+// the optimised topology lists the standard strip's vertices as separate triangles: head (three triangles meeting at the end point) followed by the bar (two triangles)
+inline std::size_t getStandardArrowStripVertexIndex(const bool isOptimised, const std::size_t vertexIndex)
+{
+	constexpr std::size_t optimisedStripIndices[]{ 0u, 1u, 2u, 1u, 3u, 2u, 3u, 4u, 2u, 9u, 1u, 3u, 9u, 3u, 8u };
+	return isOptimised ? optimisedStripIndices[vertexIndex % 15u] : vertexIndex;
+}
+
+inline sf::Vector2f getStandardArrowVertexPosition(const sf::Vector2f size, const float startThicknessInPixels, const float endThicknessInPixels, const float headSizeInPixels, const float headOvershootSizeInPixels, const bool isOptimised, const std::size_t vertexIndex)
+{
+	const float centerY{ 0.5f };
+	const float startThickness{ startThicknessInPixels / size.y };
+	const float endThickness{ endThicknessInPixels / size.y };
+	const float headSize{ headSizeInPixels / size.x };
+	const float headOvershootSize{ headOvershootSizeInPixels / size.x };
+
+	const float startHalfThickness{ startThickness / 2.f };
+	const float endHalfThickness{ endThickness / 2.f };
+	const float startBarTop{ centerY - startHalfThickness };
+	const float startBarBottom{ centerY + startHalfThickness };
+	const float endBarTop{ centerY - endHalfThickness };
+	const float endBarBottom{ centerY + endHalfThickness };
+	const float headInside{ 1.f - headSize };
+	const float headOvershoot{ headInside - headOvershootSize };
+	const sf::Vector2f endPoint{ 1.f, centerY };
+
+	switch (getStandardArrowStripVertexIndex(isOptimised, vertexIndex))
+	{
+	case 0u:
+		return{ headOvershoot, 0.f };
+	case 1u:
+		return{ headInside, endBarTop };
+	case 2u:
+		return endPoint;
+	case 3u:
+		return{ headInside, endBarBottom };
+	case 4u:
+		return{ headOvershoot, 1.f };
+	case 5u:
+		return endPoint;
+	case 6u:
+		return{ headInside, endBarBottom };
+	case 7u:
+		return{ headInside, endBarTop };
+	case 8u:
+		return{ 0.f, startBarBottom };
+	case 9u:
+		return{ 0.f, startBarTop };
+	default:
+		return endPoint;
+	}
+}
+
+} // namespace generator
+} // namespace grambol
+#endif // GRAMBOL_GENERATORS_HPP
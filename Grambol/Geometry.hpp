@@ -0,0 +1,416 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// Geometry
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_GEOMETRY_HPP
+#define GRAMBOL_GEOMETRY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+namespace grambol
+{
+namespace geometry
+{
+
+// positive when a, b, c are in clockwise order on screen (y pointing down); counter-clockwise in standard maths axes
+inline float getDoubleSignedArea(const sf::Vector2f a, const sf::Vector2f b, const sf::Vector2f c)
+{
+	return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+inline float getTriangleArea(const sf::Vector2f a, const sf::Vector2f b, const sf::Vector2f c)
+{
+	const float doubleSignedArea{ getDoubleSignedArea(a, b, c) };
+	return ((doubleSignedArea < 0.f) ? -doubleSignedArea : doubleSignedArea) / 2.f;
+}
+
+inline float getPolygonArea(const std::vector<sf::Vertex>& polygon)
+{
+	float doubleSignedArea{ 0.f };
+	for (std::size_t i{ 0u }, j{ polygon.size() - 1u }; i < polygon.size(); j = i++)
+		doubleSignedArea += polygon[j].position.x * polygon[i].position.y - polygon[i].position.x * polygon[j].position.y;
+	return ((doubleSignedArea < 0.f) ? -doubleSignedArea : doubleSignedArea) / 2.f;
+}
+
+// linear interpolation of all of the vertex's attributes (position, colour and texture co-ordinates)
+inline sf::Vertex interpolate(const sf::Vertex& a, const sf::Vertex& b, const float ratio)
+{
+	auto mix = [ratio](const float from, const float to) { return from + (to - from) * ratio; };
+	auto mixComponent = [&mix](const std::uint8_t from, const std::uint8_t to) { return static_cast<std::uint8_t>(mix(from, to) + 0.5f); };
+	sf::Vertex vertex;
+	vertex.position = { mix(a.position.x, b.position.x), mix(a.position.y, b.position.y) };
+	vertex.color = { mixComponent(a.color.r, b.color.r), mixComponent(a.color.g, b.color.g), mixComponent(a.color.b, b.color.b), mixComponent(a.color.a, b.color.a) };
+	vertex.texCoords = { mix(a.texCoords.x, b.texCoords.x), mix(a.texCoords.y, b.texCoords.y) };
+	return vertex;
+}
+
+// ratio along segment a (from aStart to aEnd) where it crosses segment b; false if they do not cross (or are parallel)
+inline bool getSegmentIntersectionRatio(const sf::Vector2f aStart, const sf::Vector2f aEnd, const sf::Vector2f bStart, const sf::Vector2f bEnd, float& ratio)
+{
+	const sf::Vector2f a{ aEnd - aStart };
+	const sf::Vector2f b{ bEnd - bStart };
+	const float denominator{ a.x * b.y - a.y * b.x };
+	if (denominator == 0.f)
+		return false;
+	const sf::Vector2f offset{ bStart - aStart };
+	const float aRatio{ (offset.x * b.y - offset.y * b.x) / denominator };
+	const float bRatio{ (offset.x * a.y - offset.y * a.x) / denominator };
+	if ((aRatio < 0.f) || (aRatio > 1.f) || (bRatio < 0.f) || (bRatio > 1.f))
+		return false;
+	ratio = aRatio;
+	return true;
+}
+
+// clips the polygon (in place) by the convex clip polygon (Sutherland-Hodgman), interpolating vertex attributes along the cuts.
+// the clip polygon can have either winding. scratch is used as temporary storage so it can be re-used between calls.
+inline void clipPolygon(std::vector<sf::Vertex>& polygon, const std::vector<sf::Vector2f>& convexClipPolygon, std::vector<sf::Vertex>& scratch)
+{
+	const std::size_t numberOfClipPoints{ convexClipPolygon.size() };
+	if (numberOfClipPoints < 3u)
+		return;
+	float orientation{ 0.f };
+	for (std::size_t i{ 2u }; (i < numberOfClipPoints) && (orientation == 0.f); ++i)
+		orientation = getDoubleSignedArea(convexClipPolygon[0u], convexClipPolygon[1u], convexClipPolygon[i]);
+	if (orientation == 0.f)
+	{
+		polygon.clear();
+		return;
+	}
+
+	for (std::size_t edge{ 0u }; (edge < numberOfClipPoints) && !polygon.empty(); ++edge)
+	{
+		const sf::Vector2f edgeStart{ convexClipPolygon[edge] };
+		const sf::Vector2f edgeEnd{ convexClipPolygon[(edge + 1u) % numberOfClipPoints] };
+		auto getInsideDistance = [&](const sf::Vector2f point) { const float distance{ getDoubleSignedArea(edgeStart, edgeEnd, point) }; return (orientation > 0.f) ? distance : -distance; };
+
+		scratch.clear();
+		for (std::size_t i{ 0u }; i < polygon.size(); ++i)
+		{
+			const sf::Vertex& current{ polygon[i] };
+			const sf::Vertex& next{ polygon[(i + 1u) % polygon.size()] };
+			const float currentDistance{ getInsideDistance(current.position) };
+			const float nextDistance{ getInsideDistance(next.position) };
+			if (currentDistance >= 0.f)
+				scratch.push_back(current);
+			if ((currentDistance >= 0.f) != (nextDistance >= 0.f))
+				scratch.push_back(interpolate(current, next, currentDistance / (currentDistance - nextDistance)));
+		}
+		polygon.swap(scratch);
+	}
+	if (polygon.size() < 3u)
+		polygon.clear();
+}
+
+// appends the triangles (a triangle list) clipped to the rectangle: triangles outside are dropped and
+// triangles crossing its edges are cut (interpolating vertex attributes) and re-triangulated as fans
+inline void appendClippedTriangles(std::vector<sf::Vertex>& output, const std::vector<sf::Vertex>& triangles, const sf::FloatRect rect)
+{
+	const sf::Vector2f topLeft{ rect.position };
+	const sf::Vector2f bottomRight{ rect.position + rect.size };
+	const std::vector<sf::Vector2f> clipRectangle{ topLeft, { bottomRight.x, topLeft.y }, bottomRight, { topLeft.x, bottomRight.y } };
+	std::vector<sf::Vertex> polygon;
+	std::vector<sf::Vertex> scratch;
+	for (std::size_t i{ 0u }; i + 2u < triangles.size(); i += 3u)
+	{
+		const sf::Vector2f a{ triangles[i].position };
+		const sf::Vector2f b{ triangles[i + 1u].position };
+		const sf::Vector2f c{ triangles[i + 2u].position };
+		const sf::Vector2f minimum{ std::min({ a.x, b.x, c.x }), std::min({ a.y, b.y, c.y }) };
+		const sf::Vector2f maximum{ std::max({ a.x, b.x, c.x }), std::max({ a.y, b.y, c.y }) };
+		if ((maximum.x < topLeft.x) || (minimum.x > bottomRight.x) || (maximum.y < topLeft.y) || (minimum.y > bottomRight.y))
+			continue;
+		if ((minimum.x >= topLeft.x) && (maximum.x <= bottomRight.x) && (minimum.y >= topLeft.y) && (maximum.y <= bottomRight.y))
+		{
+			output.insert(output.end(), triangles.begin() + i, triangles.begin() + i + 3u);
+			continue;
+		}
+		polygon.assign(triangles.begin() + i, triangles.begin() + i + 3u);
+		clipPolygon(polygon, clipRectangle, scratch);
+		for (std::size_t j{ 2u }; j < polygon.size(); ++j)
+		{
+			output.push_back(polygon[0u]);
+			output.push_back(polygon[j - 1u]);
+			output.push_back(polygon[j]);
+		}
+	}
+}
+
+struct Edge
+{
+	sf::Vector2f start;
+	sf::Vector2f end;
+};
+
+inline bool isInsideTriangle(const sf::Vector2f point, const sf::Vertex* const triangle)
+{
+	const float ab{ getDoubleSignedArea(triangle[0u].position, triangle[1u].position, point) };
+	const float bc{ getDoubleSignedArea(triangle[1u].position, triangle[2u].position, point) };
+	const float ca{ getDoubleSignedArea(triangle[2u].position, triangle[0u].position, point) };
+	return ((ab >= 0.f) && (bc >= 0.f) && (ca >= 0.f)) || ((ab <= 0.f) && (bc <= 0.f) && (ca <= 0.f));
+}
+
+inline bool isInsideTriangles(const sf::Vector2f point, const std::vector<sf::Vertex>& triangles)
+{
+	for (std::size_t i{ 0u }; i + 2u < triangles.size(); i += 3u)
+	{
+		if (isInsideTriangle(point, triangles.data() + i))
+			return true;
+	}
+	return false;
+}
+
+namespace priv
+{
+
+// merges points that are within epsilon of each other into the first of them (looked up in a grid of epsilon-sized cells)
+class PointWelder
+{
+public:
+	explicit PointWelder(const float epsilon) : m_epsilon{ epsilon }, m_cellSize{ (epsilon > 0.f) ? epsilon : 1.f }, m_points(), m_cells() { }
+
+	std::size_t add(sf::Vector2f point); // the index of the point (or of the earlier point it is merged into)
+	sf::Vector2f get(const std::size_t index) const { return m_points[index]; }
+
+private:
+	float m_epsilon;
+	float m_cellSize;
+	std::vector<sf::Vector2f> m_points;
+	std::map<std::pair<long long, long long>, std::vector<std::size_t>> m_cells;
+
+	long long priv_getCell(const float value) const { return static_cast<long long>(std::floor(value / m_cellSize)); }
+};
+
+inline std::size_t PointWelder::add(const sf::Vector2f point)
+{
+	const std::pair<long long, long long> cell{ priv_getCell(point.x), priv_getCell(point.y) };
+	for (long long x{ cell.first - 1 }; x <= cell.first + 1; ++x)
+	{
+		for (long long y{ cell.second - 1 }; y <= cell.second + 1; ++y)
+		{
+			const auto it{ m_cells.find({ x, y }) };
+			if (it == m_cells.end())
+				continue;
+			for (auto& index : it->second)
+			{
+				const sf::Vector2f offset{ m_points[index] - point };
+				if (offset.x * offset.x + offset.y * offset.y <= m_epsilon * m_epsilon)
+					return index;
+			}
+		}
+	}
+	m_points.push_back(point);
+	m_cells[cell].push_back(m_points.size() - 1u);
+	return m_points.size() - 1u;
+}
+
+} // namespace priv
+
+// edges on the outside of the union of the triangles (a triangle list), with each edge directed so that the triangles are on
+// its positive side (getDoubleSignedArea(start, end, inside) > 0) so boundary loops always run the same way around the shape.
+// points within epsilon of each other are treated as one (so loops close exactly) and edges are split where other edges meet
+// or cross them; each piece is on the boundary when only one of its sides is covered. degenerate triangles are removed from the triangles.
+inline std::vector<Edge> getBoundaryEdges(std::vector<sf::Vertex>& triangles, const float epsilon)
+{
+	std::vector<sf::Vertex> nonDegenerateTriangles;
+	for (std::size_t i{ 0u }; i + 2u < triangles.size(); i += 3u)
+	{
+		if (getDoubleSignedArea(triangles[i].position, triangles[i + 1u].position, triangles[i + 2u].position) != 0.f)
+			nonDegenerateTriangles.insert(nonDegenerateTriangles.end(), triangles.begin() + i, triangles.begin() + i + 3u);
+	}
+	triangles.swap(nonDegenerateTriangles);
+
+	// the triangles' edges (each once) and which of their sides (from the lower point index to the higher) their triangles are on
+	struct Segment
+	{
+		std::size_t start;
+		std::size_t end;
+		bool isPositiveCovered;
+		bool isNegativeCovered;
+		std::vector<std::pair<float, std::size_t>> splits; // ratio along the segment and point
+	};
+	priv::PointWelder welder{ epsilon };
+	std::vector<Segment> segments;
+	std::map<std::pair<std::size_t, std::size_t>, std::size_t> segmentIndices;
+	for (std::size_t i{ 0u }; i + 2u < triangles.size(); i += 3u)
+	{
+		const std::size_t points[3u]{ welder.add(triangles[i].position), welder.add(triangles[i + 1u].position), welder.add(triangles[i + 2u].position) };
+		if ((points[0u] == points[1u]) || (points[1u] == points[2u]) || (points[2u] == points[0u]))
+			continue;
+		for (std::size_t j{ 0u }; j < 3u; ++j)
+		{
+			const std::size_t start{ std::min(points[j], points[(j + 1u) % 3u]) };
+			const std::size_t end{ std::max(points[j], points[(j + 1u) % 3u]) };
+			auto it{ segmentIndices.find({ start, end }) };
+			if (it == segmentIndices.end())
+			{
+				it = segmentIndices.emplace(std::make_pair(start, end), segments.size()).first;
+				segments.push_back({ start, end, false, false, {} });
+			}
+			Segment& segment{ segments[it->second] };
+			if (getDoubleSignedArea(welder.get(start), welder.get(end), welder.get(points[(j + 2u) % 3u])) > 0.f)
+				segment.isPositiveCovered = true;
+			else
+				segment.isNegativeCovered = true;
+		}
+	}
+
+	// split segments where another segment's end touches them or where two segments cross (only segments whose bounds overlap are compared)
+	auto addSplitIfInside = [&](Segment& segment, const std::size_t point)
+	{
+		if ((point == segment.start) || (point == segment.end))
+			return;
+		const sf::Vector2f start{ welder.get(segment.start) };
+		const sf::Vector2f line{ welder.get(segment.end) - start };
+		const sf::Vector2f offset{ welder.get(point) - start };
+		const float lengthSquared{ line.x * line.x + line.y * line.y };
+		const float ratio{ (offset.x * line.x + offset.y * line.y) / lengthSquared };
+		const float distance{ std::abs(line.x * offset.y - line.y * offset.x) / std::sqrt(lengthSquared) };
+		if ((ratio > 0.f) && (ratio < 1.f) && (distance <= epsilon))
+			segment.splits.emplace_back(ratio, point);
+	};
+	std::vector<sf::FloatRect> bounds(segments.size());
+	std::vector<std::size_t> order(segments.size());
+	for (std::size_t i{ 0u }; i < segments.size(); ++i)
+	{
+		const sf::Vector2f start{ welder.get(segments[i].start) };
+		const sf::Vector2f end{ welder.get(segments[i].end) };
+		bounds[i].position = { std::min(start.x, end.x) - epsilon, std::min(start.y, end.y) - epsilon };
+		bounds[i].size = { std::abs(end.x - start.x) + epsilon * 2.f, std::abs(end.y - start.y) + epsilon * 2.f };
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&](const std::size_t a, const std::size_t b) { return bounds[a].position.x < bounds[b].position.x; });
+	for (std::size_t i{ 0u }; i < order.size(); ++i)
+	{
+		Segment& a{ segments[order[i]] };
+		const sf::FloatRect aBounds{ bounds[order[i]] };
+		for (std::size_t j{ i + 1u }; (j < order.size()) && (bounds[order[j]].position.x <= aBounds.position.x + aBounds.size.x); ++j)
+		{
+			const sf::FloatRect bBounds{ bounds[order[j]] };
+			if ((bBounds.position.y > aBounds.position.y + aBounds.size.y) || (aBounds.position.y > bBounds.position.y + bBounds.size.y))
+				continue;
+			Segment& b{ segments[order[j]] };
+			addSplitIfInside(a, b.start);
+			addSplitIfInside(a, b.end);
+			addSplitIfInside(b, a.start);
+			addSplitIfInside(b, a.end);
+			if ((a.start == b.start) || (a.start == b.end) || (a.end == b.start) || (a.end == b.end))
+				continue;
+			float ratio;
+			if (!getSegmentIntersectionRatio(welder.get(a.start), welder.get(a.end), welder.get(b.start), welder.get(b.end), ratio))
+				continue;
+			const std::size_t crossing{ welder.add(welder.get(a.start) + (welder.get(a.end) - welder.get(a.start)) * ratio) };
+			addSplitIfInside(a, crossing);
+			addSplitIfInside(b, crossing);
+		}
+	}
+
+	// the pieces between the splits, with the sides covered by any segment along them
+	std::map<std::pair<std::size_t, std::size_t>, std::pair<bool, bool>> pieces; // positive and negative side covered
+	for (auto& segment : segments)
+	{
+		std::sort(segment.splits.begin(), segment.splits.end());
+		std::size_t previous{ segment.start };
+		for (std::size_t i{ 0u }; i <= segment.splits.size(); ++i)
+		{
+			const std::size_t current{ (i < segment.splits.size()) ? segment.splits[i].second : segment.end };
+			if (current == previous)
+				continue;
+			const bool isReversed{ current < previous };
+			auto& sides{ pieces[isReversed ? std::make_pair(current, previous) : std::make_pair(previous, current)] };
+			if (isReversed ? segment.isNegativeCovered : segment.isPositiveCovered)
+				sides.first = true;
+			if (isReversed ? segment.isPositiveCovered : segment.isNegativeCovered)
+				sides.second = true;
+			previous = current;
+		}
+	}
+
+	// a piece covered on one side is on the boundary unless other triangles overlap its other side,
+	// tested just off its middle (each triangle is only tested against the probes within its horizontal range)
+	std::vector<Edge> candidates;
+	std::vector<sf::Vector2f> probes;
+	for (auto& piece : pieces)
+	{
+		const bool isPositiveCovered{ piece.second.first };
+		if (isPositiveCovered == piece.second.second)
+			continue;
+		const sf::Vector2f start{ welder.get(piece.first.first) };
+		const sf::Vector2f end{ welder.get(piece.first.second) };
+		const sf::Vector2f line{ end - start };
+		const float length{ std::sqrt(line.x * line.x + line.y * line.y) };
+		const sf::Vector2f positiveNormal{ -line.y / length, line.x / length };
+		probes.push_back((start + end) / 2.f + positiveNormal * (isPositiveCovered ? -epsilon : epsilon));
+		if (isPositiveCovered)
+			candidates.push_back({ start, end });
+		else
+			candidates.push_back({ end, start });
+	}
+	std::vector<bool> isOverlapped(candidates.size(), false);
+	if (epsilon > 0.f)
+	{
+		std::vector<std::size_t> probeOrder(probes.size());
+		for (std::size_t i{ 0u }; i < probeOrder.size(); ++i)
+			probeOrder[i] = i;
+		std::sort(probeOrder.begin(), probeOrder.end(), [&](const std::size_t a, const std::size_t b) { return probes[a].x < probes[b].x; });
+		for (std::size_t i{ 0u }; i + 2u < triangles.size(); i += 3u)
+		{
+			const sf::Vector2f a{ triangles[i].position };
+			const sf::Vector2f b{ triangles[i + 1u].position };
+			const sf::Vector2f c{ triangles[i + 2u].position };
+			const float minimumX{ std::min(std::min(a.x, b.x), c.x) };
+			const float maximumX{ std::max(std::max(a.x, b.x), c.x) };
+			const float minimumY{ std::min(std::min(a.y, b.y), c.y) };
+			const float maximumY{ std::max(std::max(a.y, b.y), c.y) };
+			auto it{ std::lower_bound(probeOrder.begin(), probeOrder.end(), minimumX, [&](const std::size_t probe, const float x) { return probes[probe].x < x; }) };
+			for (; (it != probeOrder.end()) && (probes[*it].x <= maximumX); ++it)
+			{
+				if (!isOverlapped[*it] && (probes[*it].y >= minimumY) && (probes[*it].y <= maximumY) && isInsideTriangle(probes[*it], triangles.data() + i))
+					isOverlapped[*it] = true;
+			}
+		}
+	}
+	std::vector<Edge> edges;
+	for (std::size_t i{ 0u }; i < candidates.size(); ++i)
+	{
+		if (!isOverlapped[i])
+			edges.push_back(candidates[i]);
+	}
+	return edges;
+}
+
+} // namespace geometry
+} // namespace grambol
+#endif // GRAMBOL_GEOMETRY_HPP
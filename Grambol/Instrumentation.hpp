@@ -0,0 +1,194 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// Instrumentation
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_INSTRUMENTATION_HPP
+#define GRAMBOL_INSTRUMENTATION_HPP
+
+// define GRAMBOL_INSTRUMENTATION (before including Grambol) to enable counters and timers.
+// without it, all of the hooks below expand to nothing and the snapshot is always empty.
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#ifdef GRAMBOL_INSTRUMENTATION
+#include <chrono>
+#include <mutex>
+#include <typeindex>
+#include <SFML/Graphics/Vertex.hpp>
+#endif // GRAMBOL_INSTRUMENTATION
+
+namespace grambol
+{
+namespace instrumentation
+{
+
+struct SymbolCounters
+{
+	std::size_t regenerations{ 0u };
+	std::size_t verticesGenerated{ 0u };
+	std::size_t redundantUpdates{ 0u }; // regenerations that produced identical vertices
+	std::size_t draws{ 0u };
+	std::size_t vertexBytesSubmitted{ 0u };
+};
+
+struct TimerTotals
+{
+	std::size_t calls{ 0u };
+	double totalMicroseconds{ 0.0 };
+	double maximumMicroseconds{ 0.0 };
+};
+
+struct Snapshot
+{
+	std::map<std::string, SymbolCounters> symbols; // keyed by type name (as given by typeid)
+	std::map<std::string, TimerTotals> timers;
+};
+
+#ifdef GRAMBOL_INSTRUMENTATION
+
+namespace priv
+{
+
+struct Registry
+{
+	std::mutex mutex;
+	std::map<std::type_index, std::pair<std::string, SymbolCounters>> symbols;
+	std::map<std::string, TimerTotals> timers;
+};
+
+inline Registry& getRegistry()
+{
+	static Registry registry;
+	return registry;
+}
+
+inline SymbolCounters& getCounters(Registry& registry, const std::type_info& type)
+{
+	auto it{ registry.symbols.find(type) };
+	if (it == registry.symbols.end())
+		it = registry.symbols.emplace(type, std::make_pair(std::string(type.name()), SymbolCounters{})).first;
+	return it->second.second;
+}
+
+inline void recordUpdate(const std::type_info& type, const std::size_t numberOfVertices, const bool isRedundant)
+{
+	Registry& registry{ getRegistry() };
+	std::lock_guard<std::mutex> lock{ registry.mutex };
+	SymbolCounters& counters{ getCounters(registry, type) };
+	++counters.regenerations;
+	counters.verticesGenerated += numberOfVertices;
+	if (isRedundant)
+		++counters.redundantUpdates;
+}
+
+inline void recordDraw(const std::type_info& type, const std::size_t numberOfVertices)
+{
+	Registry& registry{ getRegistry() };
+	std::lock_guard<std::mutex> lock{ registry.mutex };
+	SymbolCounters& counters{ getCounters(registry, type) };
+	++counters.draws;
+	counters.vertexBytesSubmitted += numberOfVertices * sizeof(sf::Vertex);
+}
+
+inline bool isSameVertex(const sf::Vertex& a, const sf::Vertex& b)
+{
+	return (a.position == b.position) && (a.color == b.color) && (a.texCoords == b.texCoords);
+}
+
+class ScopedTimer
+{
+public:
+	explicit ScopedTimer(const char* name) : m_name{ name }, m_start{ std::chrono::steady_clock::now() } { }
+	~ScopedTimer()
+	{
+		const double microseconds{ std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_start).count() };
+		Registry& registry{ getRegistry() };
+		std::lock_guard<std::mutex> lock{ registry.mutex };
+		TimerTotals& totals{ registry.timers[m_name] };
+		++totals.calls;
+		totals.totalMicroseconds += microseconds;
+		if (microseconds > totals.maximumMicroseconds)
+			totals.maximumMicroseconds = microseconds;
+	}
+	ScopedTimer(const ScopedTimer&) = delete;
+	ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+	const char* m_name;
+	const std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace priv
+
+inline Snapshot getSnapshot()
+{
+	priv::Registry& registry{ priv::getRegistry() };
+	std::lock_guard<std::mutex> lock{ registry.mutex };
+	Snapshot snapshot;
+	for (auto& symbol : registry.symbols)
+		snapshot.symbols[symbol.second.first] = symbol.second.second;
+	snapshot.timers = registry.timers;
+	return snapshot;
+}
+
+inline void reset()
+{
+	priv::Registry& registry{ priv::getRegistry() };
+	std::lock_guard<std::mutex> lock{ registry.mutex };
+	registry.symbols.clear();
+	registry.timers.clear();
+}
+
+constexpr bool isEnabled() { return true; }
+
+#define GRAMBOL_INSTRUMENTATION_CONCATENATE_IMPL(a, b) a##b
+#define GRAMBOL_INSTRUMENTATION_CONCATENATE(a, b) GRAMBOL_INSTRUMENTATION_CONCATENATE_IMPL(a, b)
+#define GRAMBOL_INSTRUMENTATION_SCOPED_TIMER(name) const ::grambol::instrumentation::priv::ScopedTimer GRAMBOL_INSTRUMENTATION_CONCATENATE(grambolScopedTimer, __LINE__){ name }
+#define GRAMBOL_INSTRUMENTATION_RECORD_UPDATE(type, numberOfVertices, isRedundant) ::grambol::instrumentation::priv::recordUpdate(type, numberOfVertices, isRedundant)
+#define GRAMBOL_INSTRUMENTATION_RECORD_DRAW(type, numberOfVertices) ::grambol::instrumentation::priv::recordDraw(type, numberOfVertices)
+
+#else // GRAMBOL_INSTRUMENTATION
+
+inline Snapshot getSnapshot() { return{}; }
+inline void reset() { }
+constexpr bool isEnabled() { return false; }
+
+#define GRAMBOL_INSTRUMENTATION_SCOPED_TIMER(name)
+#define GRAMBOL_INSTRUMENTATION_RECORD_UPDATE(type, numberOfVertices, isRedundant)
+#define GRAMBOL_INSTRUMENTATION_RECORD_DRAW(type, numberOfVertices)
+
+#endif // GRAMBOL_INSTRUMENTATION
+
+} // namespace instrumentation
+} // namespace grambol
+#endif // GRAMBOL_INSTRUMENTATION_HPP
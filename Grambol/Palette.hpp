@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// Palette
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_PALETTE_HPP
+#define GRAMBOL_PALETTE_HPP
+
+#include <initializer_list>
+#include <vector>
+#include <SFML/Graphics/Color.hpp>
+
+namespace grambol
+{
+
+class FullSymbol;
+
+// a set of colours that can be shared by many full symbols (see FullSymbol::setPalette).
+// changing the palette recolours all of its symbols in one pass without regenerating their geometry.
+// a palette must outlive its symbols (or be removed from them); copying a palette copies only its colours.
+class Palette
+{
+public:
+	Palette(std::size_t numberOfColors = 0u) : m_colors(numberOfColors), m_symbols() { }
+	Palette(std::initializer_list<sf::Color> colors) : m_colors{ colors }, m_symbols() { }
+	Palette(const Palette& other) : m_colors(other.m_colors), m_symbols() { }
+	Palette& operator=(const Palette& other);
+	~Palette();
+
+	std::size_t getNumberOfColors() const;
+	void setNumberOfColors(std::size_t numberOfColors);
+	void setColor(std::size_t colorIndex, sf::Color color);
+	sf::Color getColor(std::size_t colorIndex) const;
+	void setColors(const std::vector<sf::Color>& colors);
+
+	std::size_t getNumberOfSymbols() const;
+
+private:
+	friend class FullSymbol;
+
+	std::vector<sf::Color> m_colors;
+	std::vector<FullSymbol*> m_symbols;
+
+	void priv_recolorSymbols();
+};
+
+} // namespace grambol
+
+#include "FullSymbol.hpp" // Palette's members use FullSymbol's
+
+namespace grambol
+{
+
+inline Palette& Palette::operator=(const Palette& other)
+{
+	m_colors = other.m_colors;
+	priv_recolorSymbols();
+	return *this;
+}
+
+inline Palette::~Palette()
+{
+	const std::vector<FullSymbol*> symbols{ m_symbols };
+	for (auto& symbol : symbols)
+		symbol->setPalette(nullptr);
+}
+
+inline std::size_t Palette::getNumberOfColors() const
+{
+	return m_colors.size();
+}
+
+inline void Palette::setNumberOfColors(const std::size_t numberOfColors)
+{
+	m_colors.resize(numberOfColors);
+	priv_recolorSymbols();
+}
+
+inline void Palette::setColor(const std::size_t colorIndex, const sf::Color color)
+{
+	if (colorIndex >= m_colors.size())
+		return;
+	m_colors[colorIndex] = color;
+	priv_recolorSymbols();
+}
+
+inline sf::Color Palette::getColor(const std::size_t colorIndex) const
+{
+	if (colorIndex >= m_colors.size())
+		return sf::Color::Transparent;
+	return m_colors[colorIndex];
+}
+
+// sets all colours at once (resizing if required) before recolouring the symbols once
+inline void Palette::setColors(const std::vector<sf::Color>& colors)
+{
+	m_colors = colors;
+	priv_recolorSymbols();
+}
+
+inline std::size_t Palette::getNumberOfSymbols() const
+{
+	return m_symbols.size();
+}
+
+inline void Palette::priv_recolorSymbols()
+{
+	GRAMBOL_INSTRUMENTATION_SCOPED_TIMER("Palette::priv_recolorSymbols");
+	for (auto& symbol : m_symbols)
+		symbol->priv_recolor();
+}
+
+} // namespace grambol
+#endif // GRAMBOL_PALETTE_HPP
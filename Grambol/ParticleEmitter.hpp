@@ -0,0 +1,260 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// ParticleEmitter
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_PARTICLEEMITTER_HPP
+#define GRAMBOL_PARTICLEEMITTER_HPP
+
+#include "Symbol.hpp"
+
+#include <SFML/System/Time.hpp>
+
+namespace grambol
+{
+
+// particles that all share one template symbol's geometry (captured once, as a triangle list, with the symbol's size).
+// particle state is kept in fixed-capacity arrays (one array per property) so spawning never allocates;
+// spawning when full replaces existing particles in turn. update() moves the particles and writes one vertex stream.
+// particles are drawn with the particle's colour multiplied by the template's vertex colours, centred on its position.
+class ParticleEmitter : public sf::Drawable, public sf::Transformable
+{
+public:
+	struct Particle
+	{
+		sf::Vector2f position{ 0.f, 0.f };
+		sf::Vector2f velocity{ 0.f, 0.f };
+		sf::Angle rotation{ sf::Angle::Zero };
+		sf::Angle angularVelocity{ sf::Angle::Zero };
+		float scale{ 1.f };
+		sf::Color color{ sf::Color::White };
+		sf::Time lifetime{ sf::seconds(1.f) };
+	};
+
+	explicit ParticleEmitter(std::size_t capacity = 1000u);
+
+	void setTemplate(const Symbol& symbol); // the symbol can be destroyed afterwards
+	void setCapacity(std::size_t capacity); // removes all particles
+	std::size_t getCapacity() const;
+	void setFadeOut(bool fadeOut); // alpha falls to zero over each particle's lifetime
+	bool getFadeOut() const;
+
+	void spawn(const Particle& particle);
+	void clear();
+	std::size_t getNumberOfParticles() const;
+
+	void update(sf::Time deltaTime);
+
+private:
+	std::vector<sf::Vertex> m_templateTriangles;
+	sf::Vector2f m_templateCenter;
+	const sf::Texture* m_texture;
+	bool m_isFadingOut;
+
+	std::size_t m_capacity;
+	std::size_t m_numberOfParticles;
+	std::size_t m_nextReplaced;
+	std::vector<sf::Vector2f> m_positions;
+	std::vector<sf::Vector2f> m_velocities;
+	std::vector<float> m_rotations; // radians
+	std::vector<float> m_angularVelocities; // radians per second
+	std::vector<float> m_scales;
+	std::vector<sf::Color> m_colors;
+	std::vector<float> m_ages; // seconds
+	std::vector<float> m_lifetimes; // seconds
+
+	std::vector<sf::Vertex> m_vertices;
+	std::size_t m_numberOfVertices;
+
+	void priv_removeParticle(std::size_t index);
+	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
+
+inline ParticleEmitter::ParticleEmitter(const std::size_t capacity)
+	: m_templateTriangles()
+	, m_templateCenter{ 0.f, 0.f }
+	, m_texture{ nullptr }
+	, m_isFadingOut{ true }
+	, m_capacity{ 0u }
+	, m_numberOfParticles{ 0u }
+	, m_nextReplaced{ 0u }
+	, m_positions()
+	, m_velocities()
+	, m_rotations()
+	, m_angularVelocities()
+	, m_scales()
+	, m_colors()
+	, m_ages()
+	, m_lifetimes()
+	, m_vertices()
+	, m_numberOfVertices{ 0u }
+{
+	setCapacity(capacity);
+}
+
+inline void ParticleEmitter::setTemplate(const Symbol& symbol)
+{
+	m_templateTriangles.clear();
+	priv::appendAsTriangles(m_templateTriangles, symbol);
+	m_templateCenter = symbol.getSize() / 2.f;
+	m_texture = symbol.getTexture();
+	m_vertices.resize(m_capacity * m_templateTriangles.size());
+	m_numberOfVertices = 0u;
+}
+
+inline void ParticleEmitter::setCapacity(const std::size_t capacity)
+{
+	m_capacity = capacity;
+	m_positions.resize(capacity);
+	m_velocities.resize(capacity);
+	m_rotations.resize(capacity);
+	m_angularVelocities.resize(capacity);
+	m_scales.resize(capacity);
+	m_colors.resize(capacity);
+	m_ages.resize(capacity);
+	m_lifetimes.resize(capacity);
+	m_vertices.resize(capacity * m_templateTriangles.size());
+	clear();
+}
+
+inline std::size_t ParticleEmitter::getCapacity() const
+{
+	return m_capacity;
+}
+
+inline void ParticleEmitter::setFadeOut(const bool fadeOut)
+{
+	m_isFadingOut = fadeOut;
+}
+
+inline bool ParticleEmitter::getFadeOut() const
+{
+	return m_isFadingOut;
+}
+
+inline void ParticleEmitter::spawn(const Particle& particle)
+{
+	if (m_capacity == 0u)
+		return;
+	std::size_t index{ m_numberOfParticles };
+	if (m_numberOfParticles == m_capacity)
+	{
+		index = m_nextReplaced;
+		m_nextReplaced = (m_nextReplaced + 1u) % m_capacity;
+	}
+	else
+		++m_numberOfParticles;
+	m_positions[index] = particle.position;
+	m_velocities[index] = particle.velocity;
+	m_rotations[index] = particle.rotation.asRadians();
+	m_angularVelocities[index] = particle.angularVelocity.asRadians();
+	m_scales[index] = particle.scale;
+	m_colors[index] = particle.color;
+	m_ages[index] = 0.f;
+	m_lifetimes[index] = particle.lifetime.asSeconds();
+}
+
+inline void ParticleEmitter::clear()
+{
+	m_numberOfParticles = 0u;
+	m_nextReplaced = 0u;
+	m_numberOfVertices = 0u;
+}
+
+inline std::size_t ParticleEmitter::getNumberOfParticles() const
+{
+	return m_numberOfParticles;
+}
+
+inline void ParticleEmitter::update(const sf::Time deltaTime)
+{
+	GRAMBOL_INSTRUMENTATION_SCOPED_TIMER("ParticleEmitter::update");
+	const float seconds{ deltaTime.asSeconds() };
+	for (std::size_t i{ 0u }; i < m_numberOfParticles;)
+	{
+		m_ages[i] += seconds;
+		if (m_ages[i] >= m_lifetimes[i])
+		{
+			priv_removeParticle(i);
+			continue;
+		}
+		m_positions[i] += m_velocities[i] * seconds;
+		m_rotations[i] += m_angularVelocities[i] * seconds;
+		++i;
+	}
+
+	const std::size_t numberOfTemplateVertices{ m_templateTriangles.size() };
+	m_numberOfVertices = m_numberOfParticles * numberOfTemplateVertices;
+	for (std::size_t i{ 0u }; i < m_numberOfParticles; ++i)
+	{
+		const float cosine{ std::cos(m_rotations[i]) * m_scales[i] };
+		const float sine{ std::sin(m_rotations[i]) * m_scales[i] };
+		const sf::Vector2f position{ m_positions[i] };
+		sf::Color color{ m_colors[i] };
+		if (m_isFadingOut)
+			color.a = static_cast<std::uint8_t>(color.a * (1.f - m_ages[i] / m_lifetimes[i]));
+		sf::Vertex* vertex{ m_vertices.data() + i * numberOfTemplateVertices };
+		for (auto& templateVertex : m_templateTriangles)
+		{
+			const sf::Vector2f local{ templateVertex.position - m_templateCenter };
+			vertex->position = { position.x + local.x * cosine - local.y * sine, position.y + local.x * sine + local.y * cosine };
+			vertex->color = templateVertex.color * color;
+			vertex->texCoords = templateVertex.texCoords;
+			++vertex;
+		}
+	}
+}
+
+inline void ParticleEmitter::priv_removeParticle(const std::size_t index)
+{
+	const std::size_t last{ m_numberOfParticles - 1u };
+	m_positions[index] = m_positions[last];
+	m_velocities[index] = m_velocities[last];
+	m_rotations[index] = m_rotations[last];
+	m_angularVelocities[index] = m_angularVelocities[last];
+	m_scales[index] = m_scales[last];
+	m_colors[index] = m_colors[last];
+	m_ages[index] = m_ages[last];
+	m_lifetimes[index] = m_lifetimes[last];
+	--m_numberOfParticles;
+}
+
+inline void ParticleEmitter::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	if (m_numberOfVertices == 0u)
+		return;
+	GRAMBOL_INSTRUMENTATION_RECORD_DRAW(typeid(*this), m_numberOfVertices);
+	states.transform *= getTransform();
+	states.texture = m_texture;
+	priv::submitDraw(target, m_vertices.data(), m_numberOfVertices, sf::PrimitiveType::Triangles, states);
+}
+
+} // namespace grambol
+#endif // GRAMBOL_PARTICLEEMITTER_HPP
@@ -66,12 +66,13 @@ private:
 	sf::Color m_color;
 
 	virtual sf::Vertex priv_getVertex(std::size_t vertexIndex) const final override;
+	virtual bool priv_getVertexColor(std::size_t vertexIndex, sf::Color& color) const final override;
 };
 
 inline void PlainSymbol::setColor(const sf::Color color)
 {
 	m_color = color;
-	priv_update();
+	priv_updateColors();
 }
 
 inline sf::Color PlainSymbol::getColor() const
@@ -87,5 +88,11 @@ inline sf::Vertex PlainSymbol::priv_getVertex(std::size_t vertexIndex) const
 	return vertex;
 }
 
+inline bool PlainSymbol::priv_getVertexColor(std::size_t, sf::Color& color) const
+{
+	color = m_color;
+	return true;
+}
+
 } // namespace grambol
 #endif // GRAMBOL_PLAINSYMBOL_HPP
@@ -0,0 +1,142 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// PolygonSymbol
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_POLYGONSYMBOL_HPP
+#define GRAMBOL_POLYGONSYMBOL_HPP
+
+#include "PlainSymbol.hpp"
+#include "Triangulation.hpp"
+
+namespace grambol
+{
+
+// a symbol built from an arbitrary simple polygon (outline), optionally with holes, in normalised (0-1) space.
+// the triangulation is cached until the outline or holes change; the size is applied with the transform so resizing regenerates nothing.
+class PolygonSymbol : public PlainSymbol
+{
+public:
+	PolygonSymbol() : PlainSymbol(sf::PrimitiveType::Triangles), m_outline(), m_holes(), m_triangulation() { priv_setSizeIndependent(true); }
+	PolygonSymbol(const std::vector<sf::Vector2f>& outline, const std::vector<std::vector<sf::Vector2f>>& holes = {});
+
+	void setOutline(const std::vector<sf::Vector2f>& outline);
+	const std::vector<sf::Vector2f>& getOutline() const;
+
+	void setHoles(const std::vector<std::vector<sf::Vector2f>>& holes);
+	void addHole(const std::vector<sf::Vector2f>& hole);
+	void clearHoles();
+	std::size_t getNumberOfHoles() const;
+	const std::vector<sf::Vector2f>& getHole(std::size_t holeIndex) const;
+
+	std::size_t getNumberOfTriangles() const;
+
+private:
+	std::vector<sf::Vector2f> m_outline;
+	std::vector<std::vector<sf::Vector2f>> m_holes;
+	std::vector<sf::Vector2f> m_triangulation;
+
+	void priv_triangulate();
+	virtual std::size_t priv_getNumberOfVertices() const final override;
+	virtual sf::Vector2f priv_getVertexPosition(std::size_t vertexIndex) const final override;
+};
+
+inline PolygonSymbol::PolygonSymbol(const std::vector<sf::Vector2f>& outline, const std::vector<std::vector<sf::Vector2f>>& holes)
+	: PlainSymbol(sf::PrimitiveType::Triangles)
+	, m_outline(outline)
+	, m_holes(holes)
+	, m_triangulation()
+{
+	priv_setSizeIndependent(true);
+	priv_triangulate();
+}
+
+inline void PolygonSymbol::setOutline(const std::vector<sf::Vector2f>& outline)
+{
+	m_outline = outline;
+	priv_triangulate();
+}
+
+inline const std::vector<sf::Vector2f>& PolygonSymbol::getOutline() const
+{
+	return m_outline;
+}
+
+inline void PolygonSymbol::setHoles(const std::vector<std::vector<sf::Vector2f>>& holes)
+{
+	m_holes = holes;
+	priv_triangulate();
+}
+
+inline void PolygonSymbol::addHole(const std::vector<sf::Vector2f>& hole)
+{
+	m_holes.push_back(hole);
+	priv_triangulate();
+}
+
+inline void PolygonSymbol::clearHoles()
+{
+	m_holes.clear();
+	priv_triangulate();
+}
+
+inline std::size_t PolygonSymbol::getNumberOfHoles() const
+{
+	return m_holes.size();
+}
+
+inline const std::vector<sf::Vector2f>& PolygonSymbol::getHole(const std::size_t holeIndex) const
+{
+	return m_holes.at(holeIndex);
+}
+
+inline std::size_t PolygonSymbol::getNumberOfTriangles() const
+{
+	return m_triangulation.size() / 3u;
+}
+
+inline void PolygonSymbol::priv_triangulate()
+{
+	m_triangulation = geometry::triangulate(m_outline, m_holes);
+	priv_update();
+}
+
+inline std::size_t PolygonSymbol::priv_getNumberOfVertices() const
+{
+	return m_triangulation.size();
+}
+
+inline sf::Vector2f PolygonSymbol::priv_getVertexPosition(const std::size_t vertexIndex) const
+{
+	return m_triangulation[vertexIndex];
+}
+
+} // namespace grambol
+#endif // GRAMBOL_POLYGONSYMBOL_HPP
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// RegenerationLink
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_REGENERATIONLINK_HPP
+#define GRAMBOL_REGENERATIONLINK_HPP
+
+#include <cstddef>
+
+namespace grambol
+{
+
+class Symbol;
+
+namespace priv
+{
+
+// implemented by RegenerationScheduler; scheduled symbols report through this when they request an update and when they are destroyed
+class RegenerationSchedulerBase
+{
+public:
+	virtual void priv_onRequested(Symbol& symbol) = 0;
+	virtual void priv_onDestroyed(const Symbol& symbol) = 0;
+
+protected:
+	~RegenerationSchedulerBase() = default;
+};
+
+// a symbol's deferred update. copies are not scheduled.
+struct RegenerationLink
+{
+	RegenerationSchedulerBase* scheduler{ nullptr };
+	std::size_t symbolIndex{ 0u };
+	std::size_t pendingIndex{ 0u };
+	std::size_t firstVertexIndex{ 0u };
+	bool isPending{ false };
+	bool isColorOnly{ false };
+
+	RegenerationLink() = default;
+	RegenerationLink(const RegenerationLink&) { }
+	RegenerationLink& operator=(const RegenerationLink&) { return *this; }
+};
+
+} // namespace priv
+} // namespace grambol
+#endif // GRAMBOL_REGENERATIONLINK_HPP
@@ -0,0 +1,270 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// RegenerationScheduler
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef GRAMBOL_REGENERATIONSCHEDULER_HPP
+#define GRAMBOL_REGENERATIONSCHEDULER_HPP
+
+#include "Symbol.hpp"
+
+#include <chrono>
+#include <SFML/System/Time.hpp>
+
+namespace grambol
+{
+
+// defers the updates of the symbols added to it: a change to a scheduled symbol queues it (keeping its current, stale,
+// vertices) and process() regenerates queued symbols until the time budget runs out, carrying the rest over to the next call.
+// visible symbols (those whose bounds meet the visible area) are processed first, then larger symbols before smaller ones.
+// symbols remove themselves when destroyed; removing a symbol (or clearing) processes its queued update immediately.
+class RegenerationScheduler : public priv::RegenerationSchedulerBase
+{
+public:
+	RegenerationScheduler();
+	RegenerationScheduler(const RegenerationScheduler&) = delete;
+	RegenerationScheduler& operator=(const RegenerationScheduler&) = delete;
+	~RegenerationScheduler();
+
+	// a symbol can be in one scheduler at a time; adding it to another removes it from the first
+	void add(Symbol& symbol);
+	void remove(Symbol& symbol);
+	void clear();
+	bool contains(const Symbol& symbol) const;
+	std::size_t getNumberOfSymbols() const;
+	std::size_t getNumberOfPending() const;
+
+	// in the co-ordinates of the symbols' transforms; without a visible area, all symbols are treated as visible
+	void setVisibleArea(sf::FloatRect visibleArea);
+	void removeVisibleArea();
+
+	std::size_t process(sf::Time timeBudget); // returns the number of symbols processed (always at least one if any are queued)
+	std::size_t processAll();
+
+	virtual void priv_onRequested(Symbol& symbol) override;
+	virtual void priv_onDestroyed(const Symbol& symbol) override;
+
+private:
+	struct Priority
+	{
+		bool isVisible;
+		float area;
+		Symbol* symbol;
+	};
+
+	std::vector<Symbol*> m_pending; // in increasing priority after sorting; processed from the back
+	std::vector<Priority> m_priorities;
+	std::vector<Symbol*> m_symbols;
+	bool m_hasVisibleArea;
+	sf::FloatRect m_visibleArea;
+	bool m_isSortRequired;
+
+	void priv_sortPending();
+	void priv_processLast();
+	void priv_removePending(const Symbol& symbol);
+};
+
+inline RegenerationScheduler::RegenerationScheduler()
+	: m_pending()
+	, m_priorities()
+	, m_symbols()
+	, m_hasVisibleArea{ false }
+	, m_visibleArea()
+	, m_isSortRequired{ false }
+{
+}
+
+inline RegenerationScheduler::~RegenerationScheduler()
+{
+	clear();
+}
+
+inline void RegenerationScheduler::add(Symbol& symbol)
+{
+	priv::RegenerationLink& link{ symbol.m_extras.get().regenerationLink };
+	if (link.scheduler == this)
+		return;
+	if (link.scheduler != nullptr)
+		static_cast<RegenerationScheduler*>(link.scheduler)->remove(symbol);
+	link.scheduler = this;
+	link.symbolIndex = m_symbols.size();
+	m_symbols.push_back(&symbol);
+}
+
+inline void RegenerationScheduler::remove(Symbol& symbol)
+{
+	if (!contains(symbol))
+		return;
+	priv::RegenerationLink& link{ symbol.m_extras->regenerationLink };
+	const bool isPending{ link.isPending };
+	const std::size_t firstVertexIndex{ link.firstVertexIndex };
+	const bool isColorOnly{ link.isColorOnly };
+	priv_onDestroyed(symbol);
+	if (!isPending)
+		return;
+	if (isColorOnly)
+		symbol.priv_recolorVertices();
+	else
+		symbol.priv_regenerate(firstVertexIndex);
+}
+
+inline void RegenerationScheduler::clear()
+{
+	while (!m_symbols.empty())
+		remove(*m_symbols.back());
+}
+
+inline bool RegenerationScheduler::contains(const Symbol& symbol) const
+{
+	return symbol.priv_isScheduled() && (symbol.m_extras->regenerationLink.scheduler == this);
+}
+
+inline std::size_t RegenerationScheduler::getNumberOfSymbols() const
+{
+	return m_symbols.size();
+}
+
+inline std::size_t RegenerationScheduler::getNumberOfPending() const
+{
+	return m_pending.size();
+}
+
+inline void RegenerationScheduler::setVisibleArea(const sf::FloatRect visibleArea)
+{
+	m_visibleArea = visibleArea;
+	m_hasVisibleArea = true;
+	m_isSortRequired = true;
+}
+
+inline void RegenerationScheduler::removeVisibleArea()
+{
+	m_hasVisibleArea = false;
+	m_isSortRequired = true;
+}
+
+inline std::size_t RegenerationScheduler::process(const sf::Time timeBudget)
+{
+	GRAMBOL_INSTRUMENTATION_SCOPED_TIMER("RegenerationScheduler::process");
+	if (m_pending.empty())
+		return 0u;
+	const auto startTime{ std::chrono::steady_clock::now() };
+	const auto duration{ std::chrono::microseconds(timeBudget.asMicroseconds()) };
+	priv_sortPending();
+	std::size_t numberOfProcessed{ 0u };
+	do
+	{
+		priv_processLast();
+		++numberOfProcessed;
+	} while (!m_pending.empty() && (std::chrono::steady_clock::now() - startTime < duration));
+	return numberOfProcessed;
+}
+
+inline std::size_t RegenerationScheduler::processAll()
+{
+	std::size_t numberOfProcessed{ 0u };
+	priv_sortPending();
+	while (!m_pending.empty())
+	{
+		priv_processLast();
+		++numberOfProcessed;
+	}
+	return numberOfProcessed;
+}
+
+inline void RegenerationScheduler::priv_onRequested(Symbol& symbol)
+{
+	symbol.m_extras->regenerationLink.pendingIndex = m_pending.size();
+	m_pending.push_back(&symbol);
+	m_isSortRequired = true;
+}
+
+inline void RegenerationScheduler::priv_onDestroyed(const Symbol& symbol)
+{
+	priv::RegenerationLink& link{ symbol.m_extras->regenerationLink };
+	if (link.isPending)
+		priv_removePending(symbol);
+	link.scheduler = nullptr;
+	Symbol* const last{ m_symbols.back() };
+	m_symbols[link.symbolIndex] = last;
+	last->m_extras->regenerationLink.symbolIndex = link.symbolIndex;
+	m_symbols.pop_back();
+}
+
+// priorities are taken when sorting; the order is kept (symbols moving afterwards are not re-sorted) until the queue or visible area changes
+inline void RegenerationScheduler::priv_sortPending()
+{
+	if (!m_isSortRequired)
+		return;
+	m_isSortRequired = false;
+	m_priorities.clear();
+	for (auto symbol : m_pending)
+	{
+		const sf::FloatRect bounds{ symbol->getTransform().transformRect({ { 0.f, 0.f }, symbol->getSize() }) };
+		const bool isVisible{ !m_hasVisibleArea || bounds.findIntersection(m_visibleArea).has_value() };
+		m_priorities.push_back({ isVisible, abs(bounds.size.x * bounds.size.y), symbol });
+	}
+	std::sort(m_priorities.begin(), m_priorities.end(), [](const Priority& a, const Priority& b)
+	{
+		return (a.isVisible != b.isVisible) ? b.isVisible : (a.area < b.area);
+	});
+	for (std::size_t i{ 0u }; i < m_priorities.size(); ++i)
+	{
+		m_pending[i] = m_priorities[i].symbol;
+		m_pending[i]->m_extras->regenerationLink.pendingIndex = i;
+	}
+}
+
+// the symbol leaves the queue before its update so that changes made while updating (e.g. by observers) queue it again
+inline void RegenerationScheduler::priv_processLast()
+{
+	Symbol& symbol{ *m_pending.back() };
+	m_pending.pop_back();
+	priv::RegenerationLink& link{ symbol.m_extras->regenerationLink };
+	link.isPending = false;
+	if (link.isColorOnly)
+		symbol.priv_recolorVertices();
+	else
+		symbol.priv_regenerate(link.firstVertexIndex);
+}
+
+inline void RegenerationScheduler::priv_removePending(const Symbol& symbol)
+{
+	priv::RegenerationLink& link{ symbol.m_extras->regenerationLink };
+	Symbol* const last{ m_pending.back() };
+	m_pending[link.pendingIndex] = last;
+	last->m_extras->regenerationLink.pendingIndex = link.pendingIndex;
+	m_pending.pop_back();
+	link.isPending = false;
+	m_isSortRequired = true;
+}
+
+} // namespace grambol
+#endif // GRAMBOL_REGENERATIONSCHEDULER_HPP
@@ -0,0 +1,441 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// StrokedSymbol
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef GRAMBOL_STROKEDSYMBOL_HPP
+#define GRAMBOL_STROKEDSYMBOL_HPP
+
+#include "FullSymbol.hpp"
+#include "Geometry.hpp"
+
+#include <memory>
+
+namespace grambol
+{
+
+enum class StrokeJoin
+{
+	Miter,
+	Round,
+	Bevel,
+};
+
+// where the outline sits relative to the shape's boundary
+enum class StrokeAlignment
+{
+	Inside,
+	Centre,
+	Outside,
+};
+
+namespace geometry
+{
+
+// appends an outline (a triangle list) of the given thickness around the boundary edges (as returned by getBoundaryEdges).
+// edges are chained into loops; chains that do not close are stroked with flat ends. round joins use segments of at most maxRoundJoinAngle (radians).
+void appendStroke(std::vector<sf::Vector2f>& triangles, const std::vector<Edge>& edges, float thickness, StrokeAlignment alignment, StrokeJoin join, float miterLimit, float maxRoundJoinAngle = 0.2617994f);
+
+} // namespace geometry
+
+// draws any symbol's fill and outline together in one vertex array: the fill is the shape's own triangles (colour 0)
+// and the outline follows the outer boundary of those triangles (colour 1), including the boundaries of any holes.
+// the shape takes this symbol's size (its own transform is ignored). after modifying the shape, call update();
+// the outline is only recalculated when the shape's geometry, the stroke parameters or the size have changed
+// (resizing recalculates it straight away so that its thickness stays in pixels).
+// the fill is not cut back under an inside or centred outline so a translucent outline colour shows the fill through it.
+class StrokedSymbol : public FullSymbol
+{
+public:
+	StrokedSymbol();
+	StrokedSymbol(const StrokedSymbol&) = delete;
+	StrokedSymbol& operator=(const StrokedSymbol&) = delete;
+
+	template <class T>
+	T& setShape();
+	bool hasShape() const;
+	Symbol& getShape();
+	const Symbol& getShape() const;
+	template <class T>
+	T& getShape() { return static_cast<T&>(getShape()); }
+
+	void setFillColor(sf::Color color);
+	sf::Color getFillColor() const;
+	void setOutlineColor(sf::Color color);
+	sf::Color getOutlineColor() const;
+	void setOutlineThickness(float thickness);
+	float getOutlineThickness() const;
+	void setOutlineJoin(StrokeJoin join);
+	StrokeJoin getOutlineJoin() const;
+	void setOutlineAlignment(StrokeAlignment alignment);
+	StrokeAlignment getOutlineAlignment() const;
+	void setMiterLimit(float miterLimit); // miter joins longer than this (as a ratio of the outline's offset from the boundary) are bevelled
+	float getMiterLimit() const;
+
+	void update();
+
+private:
+	std::unique_ptr<Symbol> m_shape;
+	std::size_t m_shapeUpdateCount;
+	bool m_isStrokeDirty;
+	float m_thickness;
+	StrokeJoin m_join;
+	StrokeAlignment m_alignment;
+	float m_miterLimit;
+	std::vector<sf::Vector2f> m_positions; // fill triangles then outline triangles, as ratios of the size when generated
+	std::size_t m_numberOfFillVertices;
+	sf::Vector2f m_strokeSize; // size when generated
+
+	void priv_setStrokeParameter();
+	void priv_generateStroke();
+
+	virtual void priv_onSizeChanged() override;
+	virtual std::size_t priv_getNumberOfVertices() const override;
+	virtual sf::Vertex priv_getVertex(std::size_t vertexIndex) const override;
+	virtual std::size_t priv_getVertexColorIndex(std::size_t vertexIndex) const override;
+};
+
+namespace geometry
+{
+
+inline void appendStroke(std::vector<sf::Vector2f>& triangles, const std::vector<Edge>& edges, const float thickness, const StrokeAlignment alignment, const StrokeJoin join, const float miterLimit, const float maxRoundJoinAngle)
+{
+	if ((thickness <= 0.f) || edges.empty())
+		return;
+	float innerOffset{ -thickness };
+	if (alignment == StrokeAlignment::Centre)
+		innerOffset = -thickness / 2.f;
+	else if (alignment == StrokeAlignment::Outside)
+		innerOffset = 0.f;
+	const float outerOffset{ innerOffset + thickness };
+
+	// outward normal (the shape is on the positive side of each edge)
+	auto getNormal = [](const sf::Vector2f start, const sf::Vector2f end)
+	{
+		const sf::Vector2f direction{ end - start };
+		const float length{ std::sqrt(direction.x * direction.x + direction.y * direction.y) };
+		return (length > 0.f) ? sf::Vector2f{ direction.y / length, -direction.x / length } : sf::Vector2f{ 0.f, 0.f };
+	};
+	auto addTriangle = [&triangles](const sf::Vector2f a, const sf::Vector2f b, const sf::Vector2f c)
+	{
+		triangles.push_back(a);
+		triangles.push_back(b);
+		triangles.push_back(c);
+	};
+	// fills the gap on the outside of the turn at the point, between the offset ends of the two edges
+	auto addJoin = [&](const sf::Vector2f point, const sf::Vector2f normalBefore, const sf::Vector2f normalAfter, const float offset)
+	{
+		const sf::Vector2f a{ point + normalBefore * offset };
+		const sf::Vector2f b{ point + normalAfter * offset };
+		const float cosine{ std::max(-1.f, std::min(1.f, normalBefore.x * normalAfter.x + normalBefore.y * normalAfter.y)) };
+		switch (join)
+		{
+		case StrokeJoin::Miter:
+			if (1.f + cosine > 0.f)
+			{
+				const sf::Vector2f miter{ (normalBefore + normalAfter) / (1.f + cosine) };
+				if (std::sqrt(miter.x * miter.x + miter.y * miter.y) <= miterLimit)
+				{
+					const sf::Vector2f tip{ point + miter * offset };
+					addTriangle(point, a, tip);
+					addTriangle(point, tip, b);
+					break;
+				}
+			}
+			addTriangle(point, a, b);
+			break;
+		case StrokeJoin::Round:
+		{
+			const float angle{ std::acos(cosine) };
+			const std::size_t numberOfSegments{ std::max(std::size_t{ 1u }, static_cast<std::size_t>(std::ceil(angle / maxRoundJoinAngle))) };
+			const float turn{ (normalBefore.x * normalAfter.y - normalBefore.y * normalAfter.x < 0.f) ? -angle : angle };
+			sf::Vector2f previous{ a };
+			for (std::size_t i{ 1u }; i <= numberOfSegments; ++i)
+			{
+				const float segmentAngle{ turn * i / numberOfSegments };
+				const float c{ std::cos(segmentAngle) };
+				const float s{ std::sin(segmentAngle) };
+				const sf::Vector2f current{ (i == numberOfSegments) ? b : point + sf::Vector2f{ normalBefore.x * c - normalBefore.y * s, normalBefore.x * s + normalBefore.y * c } * offset };
+				addTriangle(point, previous, current);
+				previous = current;
+			}
+			break;
+		}
+		case StrokeJoin::Bevel:
+		default:
+			addTriangle(point, a, b);
+			break;
+		}
+	};
+
+	// chain the edges into loops (or open chains) by matching each edge's end with another edge's start
+	using Point = std::pair<float, float>;
+	std::multimap<Point, std::size_t> edgesByStart;
+	std::vector<bool> isEdgeUsed(edges.size(), false);
+	for (std::size_t i{ 0u }; i < edges.size(); ++i)
+		edgesByStart.insert({ { edges[i].start.x, edges[i].start.y }, i });
+	auto findUnusedEdgeFrom = [&](const sf::Vector2f point)
+	{
+		const auto range{ edgesByStart.equal_range({ point.x, point.y }) };
+		for (auto it{ range.first }; it != range.second; ++it)
+		{
+			if (!isEdgeUsed[it->second])
+				return it->second;
+		}
+		return edges.size();
+	};
+	std::vector<sf::Vector2f> chain;
+	for (std::size_t first{ 0u }; first < edges.size(); ++first)
+	{
+		if (isEdgeUsed[first])
+			continue;
+		chain.clear();
+		chain.push_back(edges[first].start);
+		bool isClosed{ false };
+		for (std::size_t edge{ first }; edge < edges.size(); edge = findUnusedEdgeFrom(edges[edge].end))
+		{
+			isEdgeUsed[edge] = true;
+			if (edges[edge].end == chain.front())
+			{
+				isClosed = true;
+				break;
+			}
+			chain.push_back(edges[edge].end);
+		}
+		const std::size_t numberOfPoints{ chain.size() };
+		const std::size_t numberOfSegments{ isClosed ? numberOfPoints : numberOfPoints - 1u };
+		for (std::size_t i{ 0u }; i < numberOfSegments; ++i)
+		{
+			const sf::Vector2f start{ chain[i] };
+			const sf::Vector2f end{ chain[(i + 1u) % numberOfPoints] };
+			const sf::Vector2f normal{ getNormal(start, end) };
+			addTriangle(start + normal * innerOffset, start + normal * outerOffset, end + normal * outerOffset);
+			addTriangle(start + normal * innerOffset, end + normal * outerOffset, end + normal * innerOffset);
+
+			if (!isClosed && (i + 1u == numberOfSegments))
+				continue;
+			const sf::Vector2f next{ chain[(i + 2u) % numberOfPoints] };
+			const sf::Vector2f nextNormal{ getNormal(end, next) };
+			// turning towards the inside (convex corner) opens a gap on the outer side; turning away opens one on the inner side
+			const float turn{ (end.x - start.x) * (next.y - end.y) - (end.y - start.y) * (next.x - end.x) };
+			if ((turn > 0.f) && (outerOffset > 0.f))
+				addJoin(end, normal, nextNormal, outerOffset);
+			else if ((turn < 0.f) && (innerOffset < 0.f))
+				addJoin(end, normal, nextNormal, innerOffset);
+		}
+	}
+}
+
+} // namespace geometry
+
+inline StrokedSymbol::StrokedSymbol()
+	: FullSymbol(sf::PrimitiveType::Triangles, { sf::Color::White, sf::Color::Black })
+	, m_shape()
+	, m_shapeUpdateCount{ 0u }
+	, m_isStrokeDirty{ true }
+	, m_thickness{ 1.f }
+	, m_join{ StrokeJoin::Miter }
+	, m_alignment{ StrokeAlignment::Inside }
+	, m_miterLimit{ 4.f }
+	, m_positions()
+	, m_numberOfFillVertices{ 0u }
+	, m_strokeSize{ 0.f, 0.f }
+{
+}
+
+template <class T>
+T& StrokedSymbol::setShape()
+{
+	std::unique_ptr<T> shape{ std::make_unique<T>() };
+	T& reference{ *shape };
+	m_shape = std::move(shape);
+	m_isStrokeDirty = true;
+	return reference;
+}
+
+inline bool StrokedSymbol::hasShape() const
+{
+	return static_cast<bool>(m_shape);
+}
+
+inline Symbol& StrokedSymbol::getShape()
+{
+	return *m_shape;
+}
+
+inline const Symbol& StrokedSymbol::getShape() const
+{
+	return *m_shape;
+}
+
+inline void StrokedSymbol::setFillColor(const sf::Color color)
+{
+	setColor(0u, color);
+}
+
+inline sf::Color StrokedSymbol::getFillColor() const
+{
+	return getColor(0u);
+}
+
+inline void StrokedSymbol::setOutlineColor(const sf::Color color)
+{
+	setColor(1u, color);
+}
+
+inline sf::Color StrokedSymbol::getOutlineColor() const
+{
+	return getColor(1u);
+}
+
+inline void StrokedSymbol::setOutlineThickness(const float thickness)
+{
+	m_thickness = thickness;
+	priv_setStrokeParameter();
+}
+
+inline float StrokedSymbol::getOutlineThickness() const
+{
+	return m_thickness;
+}
+
+inline void StrokedSymbol::setOutlineJoin(const StrokeJoin join)
+{
+	m_join = join;
+	priv_setStrokeParameter();
+}
+
+inline StrokeJoin StrokedSymbol::getOutlineJoin() const
+{
+	return m_join;
+}
+
+inline void StrokedSymbol::setOutlineAlignment(const StrokeAlignment alignment)
+{
+	m_alignment = alignment;
+	priv_setStrokeParameter();
+}
+
+inline StrokeAlignment StrokedSymbol::getOutlineAlignment() const
+{
+	return m_alignment;
+}
+
+inline void StrokedSymbol::setMiterLimit(const float miterLimit)
+{
+	m_miterLimit = miterLimit;
+	priv_setStrokeParameter();
+}
+
+inline float StrokedSymbol::getMiterLimit() const
+{
+	return m_miterLimit;
+}
+
+inline void StrokedSymbol::update()
+{
+	if (!m_shape)
+	{
+		if (!m_positions.empty())
+		{
+			m_positions.clear();
+			m_numberOfFillVertices = 0u;
+			priv_update();
+		}
+		return;
+	}
+	if (m_shape->getSize() != getSize())
+		m_shape->setSize(getSize());
+	if (!m_isStrokeDirty && (m_shapeUpdateCount == m_shape->getGeneration()) && (m_strokeSize == getSize()))
+		return;
+	priv_generateStroke();
+	m_isStrokeDirty = false;
+	priv_update();
+}
+
+inline void StrokedSymbol::priv_setStrokeParameter()
+{
+	m_isStrokeDirty = true;
+	update();
+}
+
+inline void StrokedSymbol::priv_generateStroke()
+{
+	GRAMBOL_INSTRUMENTATION_SCOPED_TIMER("StrokedSymbol::priv_generateStroke");
+	const sf::Vector2f size{ getSize() };
+	std::vector<sf::Vertex> triangles;
+	priv::appendAsTriangles(triangles, *m_shape);
+	const std::vector<geometry::Edge> edges{ geometry::getBoundaryEdges(triangles, std::max(size.x, size.y) * 0.0001f) };
+
+	m_positions.clear();
+	for (auto& vertex : triangles)
+		m_positions.push_back(vertex.position);
+	m_numberOfFillVertices = m_positions.size();
+	geometry::appendStroke(m_positions, edges, m_thickness, m_alignment, m_join, m_miterLimit);
+	for (std::size_t i{ 0u }; i < m_positions.size(); ++i)
+	{
+		m_positions[i].x = (size.x == 0.f) ? 0.f : m_positions[i].x / size.x;
+		m_positions[i].y = (size.y == 0.f) ? 0.f : m_positions[i].y / size.y;
+	}
+	m_shapeUpdateCount = m_shape->getGeneration();
+	m_strokeSize = size;
+}
+
+// positions are ratios of the size they were generated at, so a resized stroke is generated again before setSize updates the vertices
+inline void StrokedSymbol::priv_onSizeChanged()
+{
+	if (!m_shape || (m_strokeSize == getSize()))
+		return;
+	m_shape->setSize(getSize());
+	priv_generateStroke();
+	m_isStrokeDirty = false;
+}
+
+inline std::size_t StrokedSymbol::priv_getNumberOfVertices() const
+{
+	return m_positions.size();
+}
+
+inline sf::Vertex StrokedSymbol::priv_getVertex(const std::size_t vertexIndex) const
+{
+	sf::Vertex vertex;
+	vertex.position = m_positions[vertexIndex];
+	vertex.color = getColor(priv_getVertexColorIndex(vertexIndex));
+	return vertex;
+}
+
+inline std::size_t StrokedSymbol::priv_getVertexColorIndex(const std::size_t vertexIndex) const
+{
+	return (vertexIndex < m_numberOfFillVertices) ? 0u : 1u;
+}
+
+} // namespace grambol
+#endif // GRAMBOL_STROKEDSYMBOL_HPP
@@ -33,16 +33,29 @@
 #ifndef GRAMBOL_SYMBOL_HPP
 #define GRAMBOL_SYMBOL_HPP
 
+#include <algorithm>
 #include <exception>
+#include <initializer_list>
+#include <iterator>
 #include <string>
 #include <vector>
 #include <cmath>
+#include <typeinfo>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "Instrumentation.hpp"
+#include "Geometry.hpp"
+#include "SymbolObservers.hpp"
+#include "SymbolExtras.hpp"
+#include "DrawSubmission.hpp"
 
 namespace grambol
 {
@@ -57,51 +70,614 @@ namespace constants
 
 template <class T> T abs(const T& value) { return (value < 0) ? -value : value; }
 
+class Symbol;
+
+namespace priv
+{
+
+// writes the primitives as a separate triangle list (triangles, triangle strips and triangle fans only)
+template <class OutputIt>
+OutputIt writeAsTriangles(OutputIt output, const std::vector<sf::Vertex>& vertices, const sf::PrimitiveType primitiveType, const sf::Transform& transform)
+{
+	const std::size_t numberOfVertices{ vertices.size() };
+	auto append = [&](const std::size_t vertexIndex)
+	{
+		sf::Vertex vertex{ vertices[vertexIndex] };
+		vertex.position = transform.transformPoint(vertex.position);
+		*output++ = vertex;
+	};
+	switch (primitiveType)
+	{
+	case sf::PrimitiveType::Triangles:
+		for (std::size_t i{ 0u }; i + 2u < numberOfVertices; i += 3u)
+		{
+			append(i);
+			append(i + 1u);
+			append(i + 2u);
+		}
+		break;
+	case sf::PrimitiveType::TriangleStrip:
+		for (std::size_t i{ 2u }; i < numberOfVertices; ++i)
+		{
+			append(i - 2u);
+			append(i - 1u);
+			append(i);
+		}
+		break;
+	case sf::PrimitiveType::TriangleFan:
+		for (std::size_t i{ 2u }; i < numberOfVertices; ++i)
+		{
+			append(0u);
+			append(i - 1u);
+			append(i);
+		}
+		break;
+	default:
+		break;
+	}
+	return output;
+}
+
+// appends the primitives as a separate triangle list (triangles, triangle strips and triangle fans only)
+inline void appendAsTriangles(std::vector<sf::Vertex>& triangles, const std::vector<sf::Vertex>& vertices, const sf::PrimitiveType primitiveType, const sf::Transform& transform)
+{
+	writeAsTriangles(std::back_inserter(triangles), vertices, primitiveType, transform);
+}
+
+inline std::size_t getNumberOfTriangleVertices(const std::size_t numberOfVertices, const sf::PrimitiveType primitiveType)
+{
+	switch (primitiveType)
+	{
+	case sf::PrimitiveType::Triangles:
+		return (numberOfVertices / 3u) * 3u;
+	case sf::PrimitiveType::TriangleStrip:
+	case sf::PrimitiveType::TriangleFan:
+		return (numberOfVertices < 3u) ? 0u : (numberOfVertices - 2u) * 3u;
+	default:
+		return 0u;
+	}
+}
+
+// the span of triangle list vertices (as appended by appendAsTriangles) that use any of the vertices from first to last (inclusive)
+inline void getTriangleVertexSpan(const std::size_t first, const std::size_t last, const std::size_t numberOfVertices, const sf::PrimitiveType primitiveType, std::size_t& triangleVertexFirst, std::size_t& triangleVertexCount)
+{
+	const std::size_t numberOfTriangles{ getNumberOfTriangleVertices(numberOfVertices, primitiveType) / 3u };
+	std::size_t firstTriangle{ 0u };
+	std::size_t endTriangle{ 0u };
+	switch (primitiveType)
+	{
+	case sf::PrimitiveType::Triangles:
+		firstTriangle = first / 3u;
+		endTriangle = last / 3u + 1u;
+		break;
+	case sf::PrimitiveType::TriangleStrip:
+		firstTriangle = (first < 2u) ? 0u : first - 2u;
+		endTriangle = last + 1u;
+		break;
+	case sf::PrimitiveType::TriangleFan:
+		firstTriangle = (first < 2u) ? 0u : first - 2u;
+		endTriangle = (first == 0u) ? numberOfTriangles : last; // the first vertex is in every triangle
+		break;
+	default:
+		break;
+	}
+	endTriangle = std::min(endTriangle, numberOfTriangles);
+	firstTriangle = std::min(firstTriangle, endTriangle);
+	triangleVertexFirst = firstTriangle * 3u;
+	triangleVertexCount = (endTriangle - firstTriangle) * 3u;
+}
+
+} // namespace priv
+
+// standard topology uses the symbol's own primitive ordering, which may include overlapping or degenerate triangles.
+// optimised topology (where supported) uses a minimal triangle list with no overlapping or degenerate triangles.
+enum class Topology
+{
+	Standard,
+	Optimised,
+};
+
+// vertices affected by a change: count vertices (or all of those remaining) starting at first, every stride vertices
+struct VertexRange
+{
+	static constexpr std::size_t all{ static_cast<std::size_t>(-1) };
+
+	std::size_t first{ 0u };
+	std::size_t count{ all };
+	std::size_t stride{ 1u };
+};
+
+class CompositeSymbol;
+class SymbolBatch;
+class SymbolLayer;
+class ArrowGraph;
+class RegenerationScheduler;
+class VertexBudget;
+
 class Symbol : public sf::Drawable, public sf::Transformable
 {
 public:
 	Symbol(sf::PrimitiveType primitiveType = sf::PrimitiveType::Triangles) : m_primitiveType{ primitiveType } { }
-	virtual ~Symbol() { }
+	virtual ~Symbol();
 
 	void setSize(sf::Vector2f size);
 	sf::Vector2f getSize() const;
 
+	// when a texture is set, texture co-ordinates are generated by mapping the symbol's 0-1 space onto the texture rectangle.
+	// as with sf::Shape, the rectangle is also reset to the whole texture when there was no texture (or no rectangle) before.
+	void setTexture(const sf::Texture* texture, bool resetRect = false);
+	const sf::Texture* getTexture() const;
+	void setTextureRect(sf::FloatRect textureRect);
+	sf::FloatRect getTextureRect() const;
+
+	// a clip rectangle (in the symbol's local space, before its transform) cuts the symbol's triangles on the CPU so that
+	// clipped symbols can still be batched; clipped symbols are drawn as a triangle list
+	void setClipRect(sf::FloatRect clipRect);
+	void removeClipRect();
+	bool isClipped() const;
+	sf::FloatRect getClipRect() const;
+
+	// the generation increases every time the symbol's vertices change (geometry or colour).
+	// observers are called after each change; the transform setters below hide sf::Transformable's so that they can
+	// notify (changes made through an sf::Transformable reference are not seen). an observer must not add or remove observers.
+	// observers are told when the symbol is destroyed so that they never need to hold a dangling pointer.
+	std::size_t getGeneration() const;
+	VertexRange getChangedVertices() const; // the span of vertices changed by the most recent change (count is VertexRange::all if any may have)
+	std::size_t addObserver(SymbolObserver observer) const; // returns an id for removeObserver
+	void removeObserver(std::size_t observerId) const;
+	void setPosition(sf::Vector2f position);
+	void setRotation(sf::Angle angle);
+	void setScale(sf::Vector2f factors);
+	void setOrigin(sf::Vector2f origin);
+	void move(sf::Vector2f offset);
+	void rotate(sf::Angle angle);
+	void scale(sf::Vector2f factor);
+
+	// the symbol's vertices (after clipping) for use outside of SFML's drawing, e.g. a mapped buffer or another renderer.
+	// writeVertices writes getNumberOfVertices() vertices, with the symbol's current transform applied if transformed.
+	// without stored vertices, updates do not generate any; they are written straight from the symbol's parameters
+	// and only generated (and kept until the next update) when the symbol is drawn, batched or clipped.
+	std::size_t getNumberOfVertices() const;
+	sf::PrimitiveType getPrimitiveType() const;
+	template <class OutputIt>
+	OutputIt writeVertices(OutputIt output, bool isTransformed = false) const; // returns the iterator past the last vertex written
+	std::size_t writeVertices(sf::Vertex* vertices, std::size_t capacity, bool isTransformed = false) const; // returns the number written (none if capacity is too small)
+	void setStoresVertices(bool storesVertices);
+	bool getStoresVertices() const;
+
+	// double-buffered mode allows the symbol to be modified on one thread while being drawn on another:
+	// updates (on the modifying thread) are published automatically along with the transform at that time;
+	// call publish() after changing only the transform. draw() only reads the front buffer, which is
+	// replaced with the most recently published one when swapBuffers() is called (on the drawing thread).
+	void setDoubleBuffered(bool isDoubleBuffered);
+	bool getDoubleBuffered() const;
+	void publish();
+	void swapBuffers();
+
 protected:
 	virtual std::size_t priv_getNumberOfVertices() const = 0;
 	virtual sf::Vertex priv_getVertex(std::size_t vertexIndex) const = 0;
 	void priv_update();
+	void priv_updateFrom(std::size_t firstVertexIndex); // regenerates only the vertices from the index onwards (the earlier ones must be unchanged)
+	void priv_updateRange(VertexRange range); // regenerates only the vertices in the range (the others must be unchanged)
+	void priv_updateRanges(std::initializer_list<VertexRange> ranges);
+	void priv_updateRanges(const VertexRange* ranges, std::size_t numberOfRanges);
+	void priv_setPrimitiveType(sf::PrimitiveType primitiveType);
+	std::size_t priv_getUpdateCount() const;
+
+	// a size-independent symbol generates its (0-1) vertices without its size, which is applied with its transform instead (unless clipped),
+	// so resizing only regenerates the vertices that still depend on the size (e.g. those placed by a thickness in pixels); none by default.
+	void priv_setSizeIndependent(bool isSizeIndependent);
+	virtual VertexRange priv_getSizeDependentVertices() const;
+
+	// a symbol that generates its vertices in its local (pixel) space, rather than 0-1, is not scaled by its size
+	// (texture co-ordinates still map its size onto the texture rectangle)
+	void priv_setGeneratedInPixels(bool isGeneratedInPixels);
+
+	// called by setSize with the new size set, before the vertices are updated
+	virtual void priv_onSizeChanged();
+
+	// recolours the current vertices without regenerating their geometry (a full update is used instead if any vertex has no colour)
+	void priv_updateColors();
+	virtual bool priv_getVertexColor(std::size_t vertexIndex, sf::Color& color) const;
 
 private:
-	const sf::PrimitiveType m_primitiveType;
-	std::vector<sf::Vertex> m_vertices;
+	friend class CompositeSymbol;
+	friend class SymbolBatch;
+	friend class SymbolLayer;
+	friend class ArrowGraph;
+	friend class RegenerationScheduler;
+	friend class VertexBudget;
+
+	sf::PrimitiveType m_primitiveType;
+	mutable std::vector<sf::Vertex> m_vertices; // mutable so that vertices evicted by a vertex budget can be regenerated when needed
 	sf::Vector2f m_size;
+	const sf::Texture* m_texture{ nullptr };
+	sf::FloatRect m_textureRect;
+	std::size_t m_updateCount{ 0u };
+	mutable priv::SymbolObserverList m_observers; // mutable so that a symbol can be observed through a const reference
+	mutable priv::SymbolExtrasPointer m_extras; // mutable so that clipped and evicted vertices can be regenerated when needed
+	bool m_storesVertices{ true };
+	bool m_isSizeIndependent{ false };
+	bool m_isGeneratedInPixels{ false };
+	VertexRange m_changedVertices;
 
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	const std::vector<sf::Vertex>& priv_getDrawVertices() const;
+	sf::Transform priv_getDrawTransform() const;
+	sf::PrimitiveType priv_getDrawPrimitiveType() const;
+	const std::vector<sf::Vertex>& priv_getOutputVertices() const;
+	sf::PrimitiveType priv_getOutputPrimitiveType() const;
+	bool priv_isSizeInTransform() const;
+	sf::Transform priv_getLocalTransform() const;
+	void priv_clip() const;
+	sf::Vertex priv_generateVertex(std::size_t vertexIndex) const;
+	bool priv_generateVertices(std::size_t firstVertexIndex = 0u) const;
+	void priv_discardVertices();
+	void priv_regenerate(std::size_t firstVertexIndex);
+	void priv_regenerateRanges(const VertexRange* ranges, std::size_t numberOfRanges, std::size_t firstVertexIndex);
+	void priv_onVerticesChanged(SymbolChange change, VertexRange changedVertices);
+	void priv_recolorVertices();
+	void priv_requestRegeneration(std::size_t firstVertexIndex, bool isColorOnly);
+	void priv_ensureVertices() const;
+	priv::VertexBudgetBase* priv_getBudget() const;
+	bool priv_isEvicted() const;
+	bool priv_isScheduled() const;
 };
 
+inline Symbol::~Symbol()
+{
+	m_observers.notify(*this, SymbolChange::Destroyed);
+	if (priv_getBudget() != nullptr)
+		priv_getBudget()->priv_onDestroyed(*this);
+	if (priv_isScheduled())
+		m_extras->regenerationLink.scheduler->priv_onDestroyed(*this);
+}
+
 inline void Symbol::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-	states.transform *= getTransform();
-	states.texture = nullptr;
-	target.draw(m_vertices.data(), m_vertices.size(), m_primitiveType, states);
+	const std::vector<sf::Vertex>& vertices{ priv_getDrawVertices() };
+	GRAMBOL_INSTRUMENTATION_RECORD_DRAW(typeid(*this), vertices.size());
+	states.transform *= priv_getDrawTransform();
+	states.texture = m_texture;
+	priv::submitDraw(target, vertices.data(), vertices.size(), priv_getDrawPrimitiveType(), states);
+}
+
+inline const std::vector<sf::Vertex>& Symbol::priv_getDrawVertices() const
+{
+	return getDoubleBuffered() ? m_extras->swapChain->getFront().vertices : priv_getOutputVertices();
+}
+
+inline sf::Transform Symbol::priv_getDrawTransform() const
+{
+	return getDoubleBuffered() ? m_extras->swapChain->getFront().transform : getTransform() * priv_getLocalTransform();
+}
+
+inline sf::PrimitiveType Symbol::priv_getDrawPrimitiveType() const
+{
+	return getDoubleBuffered() ? m_extras->swapChain->getFront().primitiveType : priv_getOutputPrimitiveType();
+}
+
+// vertices as generated, or clipped
+inline const std::vector<sf::Vertex>& Symbol::priv_getOutputVertices() const
+{
+	priv_ensureVertices();
+	return isClipped() ? m_extras->clippedVertices : m_vertices;
+}
+
+inline sf::PrimitiveType Symbol::priv_getOutputPrimitiveType() const
+{
+	return isClipped() ? sf::PrimitiveType::Triangles : m_primitiveType;
+}
+
+inline bool Symbol::priv_isSizeInTransform() const
+{
+	return m_isSizeIndependent && !isClipped();
+}
+
+// maps the output vertices to the symbol's local (pixel) space
+inline sf::Transform Symbol::priv_getLocalTransform() const
+{
+	if (!priv_isSizeInTransform())
+		return sf::Transform::Identity;
+	sf::Transform transform;
+	transform.scale(m_size);
+	return transform;
+}
+
+// regenerates the vertices if they were evicted by a vertex budget and marks them as recently used
+inline void Symbol::priv_ensureVertices() const
+{
+	if (priv_getBudget() != nullptr)
+		priv_getBudget()->priv_onUsed(*this);
+	else if (priv_isEvicted())
+	{
+		priv_generateVertices();
+		m_extras->budgetLink.isEvicted = false;
+	}
+}
+
+inline priv::VertexBudgetBase* Symbol::priv_getBudget() const
+{
+	return m_extras ? m_extras->budgetLink.budget : nullptr;
+}
+
+inline bool Symbol::priv_isEvicted() const
+{
+	return m_extras && m_extras->budgetLink.isEvicted;
+}
+
+inline bool Symbol::priv_isScheduled() const
+{
+	return m_extras && (m_extras->regenerationLink.scheduler != nullptr);
+}
+
+inline void Symbol::priv_clip() const
+{
+	if (!m_extras)
+		return;
+	m_extras->clippedVertices.clear();
+	if (!m_extras->isClipped)
+		return;
+	std::vector<sf::Vertex> triangles;
+	priv::appendAsTriangles(triangles, m_vertices, m_primitiveType, sf::Transform::Identity);
+	geometry::appendClippedTriangles(m_extras->clippedVertices, triangles, m_extras->clipRect);
+}
+
+// a vertex as stored: texture co-ordinates mapped and position scaled by size (unless the size is applied by the transform)
+inline sf::Vertex Symbol::priv_generateVertex(const std::size_t vertexIndex) const
+{
+	sf::Vertex vertex{ priv_getVertex(vertexIndex) };
+	if (m_texture != nullptr)
+	{
+		sf::Vector2f ratio{ vertex.position };
+		if (m_isGeneratedInPixels)
+			ratio = { (m_size.x == 0.f) ? 0.f : ratio.x / m_size.x, (m_size.y == 0.f) ? 0.f : ratio.y / m_size.y };
+		vertex.texCoords.x = m_textureRect.position.x + ratio.x * m_textureRect.size.x;
+		vertex.texCoords.y = m_textureRect.position.y + ratio.y * m_textureRect.size.y;
+	}
+	if (!priv_isSizeInTransform() && !m_isGeneratedInPixels)
+	{
+		vertex.position.x = vertex.position.x * m_size.x;
+		vertex.position.y = vertex.position.y * m_size.y;
+	}
+	return vertex;
+}
+
+// fills (and clips) the vertices from the current parameters, keeping those before the first index (if they exist);
+// returns whether the generated vertices were unchanged (instrumentation only)
+inline bool Symbol::priv_generateVertices(std::size_t firstVertexIndex) const
+{
+	const std::size_t numberOfVertices{ priv_getNumberOfVertices() };
+	if (firstVertexIndex > std::min(m_vertices.size(), numberOfVertices))
+		firstVertexIndex = 0u;
+	bool isRedundant{ m_vertices.size() == numberOfVertices };
+	m_vertices.resize(numberOfVertices);
+	for (auto begin{ m_vertices.begin() }, end{ m_vertices.end() }, it{ begin + firstVertexIndex }; it != end; ++it)
+	{
+		const sf::Vertex vertex{ priv_generateVertex(static_cast<std::size_t>(it - begin)) };
+#ifdef GRAMBOL_INSTRUMENTATION
+		if (isRedundant && !instrumentation::priv::isSameVertex(*it, vertex))
+			isRedundant = false;
+#endif // GRAMBOL_INSTRUMENTATION
+		*it = vertex;
+	}
+	if (isClipped())
+		priv_clip();
+	return isRedundant;
 }
 
 inline void Symbol::priv_update()
 {
-	m_vertices.resize(priv_getNumberOfVertices());
-	for (auto begin{ m_vertices.begin() }, end{ m_vertices.end() }, it{ begin }; it != end; ++it)
+	priv_updateFrom(0u);
+}
+
+inline void Symbol::priv_updateFrom(const std::size_t firstVertexIndex)
+{
+	if (priv_isScheduled())
+		priv_requestRegeneration(firstVertexIndex, false);
+	else
+		priv_regenerate(firstVertexIndex);
+}
+
+// deferred until the scheduler processes the symbol; requests made before then are merged (colours and geometry together need a full update)
+inline void Symbol::priv_requestRegeneration(const std::size_t firstVertexIndex, const bool isColorOnly)
+{
+	priv::RegenerationLink& link{ m_extras->regenerationLink };
+	if (!link.isPending)
+	{
+		link.isPending = true;
+		link.firstVertexIndex = firstVertexIndex;
+		link.isColorOnly = isColorOnly;
+		link.scheduler->priv_onRequested(*this);
+	}
+	else if (link.isColorOnly != isColorOnly)
 	{
-		const std::size_t vertexIndex{ static_cast<std::size_t>(it - begin) };
-		*it = priv_getVertex(vertexIndex);
-		it->position.x = it->position.x * m_size.x;
-		it->position.y = it->position.y * m_size.y;
+		link.firstVertexIndex = 0u;
+		link.isColorOnly = false;
 	}
+	else
+		link.firstVertexIndex = std::min(link.firstVertexIndex, firstVertexIndex);
 }
 
+inline void Symbol::priv_regenerate(const std::size_t firstVertexIndex)
+{
+	GRAMBOL_INSTRUMENTATION_SCOPED_TIMER("Symbol::priv_update");
+	if (m_storesVertices)
+	{
+		[[maybe_unused]] const bool isRedundant{ priv_generateVertices(firstVertexIndex) };
+		GRAMBOL_INSTRUMENTATION_RECORD_UPDATE(typeid(*this), m_vertices.size(), isRedundant);
+		if (priv_getBudget() != nullptr)
+			priv_getBudget()->priv_onGenerated(*this);
+	}
+	else
+		priv_discardVertices();
+	priv_onVerticesChanged(SymbolChange::Geometry, { isClipped() ? 0u : firstVertexIndex });
+}
+
+inline void Symbol::priv_updateRange(const VertexRange range)
+{
+	priv_updateRanges(&range, 1u);
+}
+
+inline void Symbol::priv_updateRanges(const std::initializer_list<VertexRange> ranges)
+{
+	priv_updateRanges(ranges.begin(), ranges.size());
+}
+
+inline void Symbol::priv_updateRanges(const VertexRange* const ranges, const std::size_t numberOfRanges)
+{
+	std::size_t firstVertexIndex{ VertexRange::all };
+	for (std::size_t i{ 0u }; i < numberOfRanges; ++i)
+	{
+		if (ranges[i].count != 0u)
+			firstVertexIndex = std::min(firstVertexIndex, ranges[i].first);
+	}
+	if (firstVertexIndex == VertexRange::all)
+		priv_onVerticesChanged(SymbolChange::Geometry, { 0u, 0u });
+	else if (priv_isScheduled())
+		priv_requestRegeneration(firstVertexIndex, false);
+	else
+		priv_regenerateRanges(ranges, numberOfRanges, firstVertexIndex);
+}
+
+// falls back to regenerating from the first vertex of the ranges if the vertices are not all held (or their number changes)
+inline void Symbol::priv_regenerateRanges(const VertexRange* const ranges, const std::size_t numberOfRanges, const std::size_t firstVertexIndex)
+{
+	const std::size_t numberOfVertices{ priv_getNumberOfVertices() };
+	bool isFallbackRequired{ !m_storesVertices || priv_isEvicted() || (m_vertices.size() != numberOfVertices) };
+	for (std::size_t i{ 0u }; i < numberOfRanges; ++i)
+		isFallbackRequired = isFallbackRequired || ((ranges[i].count != 0u) && (ranges[i].stride == 0u));
+	if (isFallbackRequired)
+	{
+		priv_regenerate(firstVertexIndex);
+		return;
+	}
+	GRAMBOL_INSTRUMENTATION_SCOPED_TIMER("Symbol::priv_update");
+	std::size_t numberOfRegenerated{ 0u };
+	std::size_t lastVertexIndex{ firstVertexIndex };
+	for (std::size_t r{ 0u }; r < numberOfRanges; ++r)
+	{
+		const VertexRange& range{ ranges[r] };
+		for (std::size_t i{ range.first }, n{ 0u }; (i < numberOfVertices) && (n < range.count); i += range.stride, ++n)
+		{
+			m_vertices[i] = priv_generateVertex(i);
+			lastVertexIndex = std::max(lastVertexIndex, i);
+			++numberOfRegenerated;
+		}
+	}
+	if (isClipped())
+		priv_clip();
+	GRAMBOL_INSTRUMENTATION_RECORD_UPDATE(typeid(*this), numberOfRegenerated, false);
+	if (priv_getBudget() != nullptr)
+		priv_getBudget()->priv_onGenerated(*this);
+	if (isClipped())
+		priv_onVerticesChanged(SymbolChange::Geometry, {});
+	else
+		priv_onVerticesChanged(SymbolChange::Geometry, { firstVertexIndex, lastVertexIndex - firstVertexIndex + 1u });
+}
+
+inline void Symbol::priv_onVerticesChanged(const SymbolChange change, const VertexRange changedVertices)
+{
+	++m_updateCount;
+	m_changedVertices = changedVertices;
+	if (getDoubleBuffered())
+		publish();
+	m_observers.notify(*this, change);
+}
+
+// releases the vertices; they are regenerated when next needed
+inline void Symbol::priv_discardVertices()
+{
+	std::vector<sf::Vertex>().swap(m_vertices);
+	if (m_extras)
+		std::vector<sf::Vertex>().swap(m_extras->clippedVertices);
+	if (priv_getBudget() != nullptr)
+		priv_getBudget()->priv_onDiscarded(*this);
+	else
+		m_extras.get().budgetLink.isEvicted = true;
+}
+
+inline void Symbol::priv_setPrimitiveType(const sf::PrimitiveType primitiveType)
+{
+	m_primitiveType = primitiveType;
+}
+
+inline std::size_t Symbol::priv_getUpdateCount() const
+{
+	return m_updateCount;
+}
+
+inline void Symbol::priv_updateColors()
+{
+	if (priv_isScheduled())
+		priv_requestRegeneration(0u, true);
+	else
+		priv_recolorVertices();
+}
+
+inline void Symbol::priv_recolorVertices()
+{
+	GRAMBOL_INSTRUMENTATION_SCOPED_TIMER("Symbol::priv_updateColors");
+	if (m_vertices.size() != priv_getNumberOfVertices())
+	{
+		priv_regenerate(0u);
+		return;
+	}
+	for (std::size_t i{ 0u }; i < m_vertices.size(); ++i)
+	{
+		if (!priv_getVertexColor(i, m_vertices[i].color))
+		{
+			priv_regenerate(0u);
+			return;
+		}
+	}
+	if (isClipped())
+		priv_clip();
+	priv_onVerticesChanged(SymbolChange::Color, {});
+}
+
+inline bool Symbol::priv_getVertexColor(std::size_t, sf::Color&) const
+{
+	return false;
+}
+
+inline void Symbol::priv_setSizeIndependent(const bool isSizeIndependent)
+{
+	if (m_isSizeIndependent == isSizeIndependent)
+		return;
+	m_isSizeIndependent = isSizeIndependent;
+	if (m_updateCount != 0u)
+		priv_update();
+}
+
+inline VertexRange Symbol::priv_getSizeDependentVertices() const
+{
+	return{ 0u, 0u };
+}
+
+inline void Symbol::priv_setGeneratedInPixels(const bool isGeneratedInPixels)
+{
+	if (m_isGeneratedInPixels == isGeneratedInPixels)
+		return;
+	m_isGeneratedInPixels = isGeneratedInPixels;
+	if (m_updateCount != 0u)
+		priv_update();
+}
+
+inline void Symbol::priv_onSizeChanged()
+{
+}
+
+// the generation still increases for size-independent symbols as their output (in local space) changes
 inline void Symbol::setSize(const sf::Vector2f size)
 {
 	m_size = size;
-	priv_update();
+	priv_onSizeChanged();
+	if (!priv_isSizeInTransform() || (m_updateCount == 0u))
+		priv_update();
+	else
+		priv_updateRange(priv_getSizeDependentVertices());
 }
 
 inline sf::Vector2f Symbol::getSize() const
@@ -109,6 +685,232 @@ inline sf::Vector2f Symbol::getSize() const
 	return m_size;
 }
 
+inline void Symbol::setTexture(const sf::Texture* texture, const bool resetRect)
+{
+	const bool isRectUnset{ (m_texture == nullptr) || (m_textureRect.size.x == 0.f) || (m_textureRect.size.y == 0.f) };
+	m_texture = texture;
+	if ((resetRect || isRectUnset) && (m_texture != nullptr))
+		m_textureRect = { { 0.f, 0.f }, sf::Vector2f(m_texture->getSize()) };
+	priv_update();
+}
+
+inline const sf::Texture* Symbol::getTexture() const
+{
+	return m_texture;
+}
+
+inline void Symbol::setTextureRect(const sf::FloatRect textureRect)
+{
+	m_textureRect = textureRect;
+	priv_update();
+}
+
+inline sf::FloatRect Symbol::getTextureRect() const
+{
+	return m_textureRect;
+}
+
+inline void Symbol::setClipRect(const sf::FloatRect clipRect)
+{
+	m_extras.get().isClipped = true;
+	m_extras->clipRect = clipRect;
+	priv_regenerate(0u); // not deferred: clipping changes whether the size is applied by the transform
+}
+
+inline void Symbol::removeClipRect()
+{
+	if (!m_extras)
+		return;
+	m_extras->isClipped = false;
+	m_extras->clippedVertices.clear();
+	priv_regenerate(0u); // not deferred: clipping changes whether the size is applied by the transform
+}
+
+inline bool Symbol::isClipped() const
+{
+	return m_extras && m_extras->isClipped;
+}
+
+inline sf::FloatRect Symbol::getClipRect() const
+{
+	return m_extras ? m_extras->clipRect : sf::FloatRect{};
+}
+
+inline std::size_t Symbol::getGeneration() const
+{
+	return m_updateCount;
+}
+
+inline VertexRange Symbol::getChangedVertices() const
+{
+	return m_changedVertices;
+}
+
+inline std::size_t Symbol::addObserver(SymbolObserver observer) const
+{
+	return m_observers.add(std::move(observer));
+}
+
+inline void Symbol::removeObserver(const std::size_t observerId) const
+{
+	m_observers.remove(observerId);
+}
+
+inline void Symbol::setPosition(const sf::Vector2f position)
+{
+	sf::Transformable::setPosition(position);
+	m_observers.notify(*this, SymbolChange::Transform);
+}
+
+inline void Symbol::setRotation(const sf::Angle angle)
+{
+	sf::Transformable::setRotation(angle);
+	m_observers.notify(*this, SymbolChange::Transform);
+}
+
+inline void Symbol::setScale(const sf::Vector2f factors)
+{
+	sf::Transformable::setScale(factors);
+	m_observers.notify(*this, SymbolChange::Transform);
+}
+
+inline void Symbol::setOrigin(const sf::Vector2f origin)
+{
+	sf::Transformable::setOrigin(origin);
+	m_observers.notify(*this, SymbolChange::Transform);
+}
+
+inline void Symbol::move(const sf::Vector2f offset)
+{
+	sf::Transformable::move(offset);
+	m_observers.notify(*this, SymbolChange::Transform);
+}
+
+inline void Symbol::rotate(const sf::Angle angle)
+{
+	sf::Transformable::rotate(angle);
+	m_observers.notify(*this, SymbolChange::Transform);
+}
+
+inline void Symbol::scale(const sf::Vector2f factor)
+{
+	sf::Transformable::scale(factor);
+	m_observers.notify(*this, SymbolChange::Transform);
+}
+
+inline std::size_t Symbol::getNumberOfVertices() const
+{
+	if (priv_isEvicted() && !isClipped())
+		return priv_getNumberOfVertices();
+	return priv_getOutputVertices().size();
+}
+
+inline sf::PrimitiveType Symbol::getPrimitiveType() const
+{
+	return priv_getOutputPrimitiveType();
+}
+
+template <class OutputIt>
+OutputIt Symbol::writeVertices(OutputIt output, const bool isTransformed) const
+{
+	const sf::Transform transform{ isTransformed ? getTransform() * priv_getLocalTransform() : priv_getLocalTransform() };
+	const bool isTransformRequired{ isTransformed || priv_isSizeInTransform() };
+	// vertices that are not held are written directly (clipping needs them all first)
+	if (priv_isEvicted() && !isClipped())
+	{
+		const std::size_t numberOfVertices{ priv_getNumberOfVertices() };
+		for (std::size_t i{ 0u }; i < numberOfVertices; ++i)
+		{
+			sf::Vertex vertex{ priv_generateVertex(i) };
+			if (isTransformRequired)
+				vertex.position = transform.transformPoint(vertex.position);
+			*output++ = vertex;
+		}
+		return output;
+	}
+	for (auto& storedVertex : priv_getOutputVertices())
+	{
+		sf::Vertex vertex{ storedVertex };
+		if (isTransformRequired)
+			vertex.position = transform.transformPoint(vertex.position);
+		*output++ = vertex;
+	}
+	return output;
+}
+
+inline std::size_t Symbol::writeVertices(sf::Vertex* const vertices, const std::size_t capacity, const bool isTransformed) const
+{
+	const std::size_t numberOfVertices{ getNumberOfVertices() };
+	if (capacity < numberOfVertices)
+		return 0u;
+	writeVertices(vertices, isTransformed);
+	return numberOfVertices;
+}
+
+inline void Symbol::setStoresVertices(const bool storesVertices)
+{
+	if (m_storesVertices == storesVertices)
+		return;
+	m_storesVertices = storesVertices;
+	if (m_storesVertices)
+		priv_ensureVertices();
+	else
+		priv_discardVertices();
+}
+
+inline bool Symbol::getStoresVertices() const
+{
+	return m_storesVertices;
+}
+
+inline void Symbol::setDoubleBuffered(const bool isDoubleBuffered)
+{
+	if (!isDoubleBuffered)
+	{
+		if (m_extras)
+			m_extras->swapChain.reset();
+	}
+	else if (!getDoubleBuffered())
+		m_extras.get().swapChain.create({ priv_getOutputVertices(), getTransform() * priv_getLocalTransform(), priv_getOutputPrimitiveType() });
+}
+
+inline bool Symbol::getDoubleBuffered() const
+{
+	return m_extras && m_extras->swapChain;
+}
+
+inline void Symbol::publish()
+{
+	if (!getDoubleBuffered())
+		return;
+	priv::VertexSwapChain::Buffer& back{ m_extras->swapChain->getBack() };
+	const std::vector<sf::Vertex>& vertices{ priv_getOutputVertices() };
+	back.vertices.assign(vertices.begin(), vertices.end());
+	back.transform = getTransform() * priv_getLocalTransform();
+	back.primitiveType = priv_getOutputPrimitiveType();
+	m_extras->swapChain->publish();
+}
+
+inline void Symbol::swapBuffers()
+{
+	if (getDoubleBuffered())
+		m_extras->swapChain->swap();
+}
+
+namespace priv
+{
+
+// appends the symbol's vertices (in its local space, without its transform) as a triangle list, using only its public interface
+inline void appendAsTriangles(std::vector<sf::Vertex>& triangles, const Symbol& symbol)
+{
+	std::vector<sf::Vertex> vertices;
+	vertices.reserve(symbol.getNumberOfVertices());
+	symbol.writeVertices(std::back_inserter(vertices));
+	appendAsTriangles(triangles, vertices, symbol.getPrimitiveType(), sf::Transform::Identity);
+}
+
+} // namespace priv
+
 } // namespace grambol
 
 #ifndef GRAMBOL_NO_NAMESPACE_SHORTCUT
@@ -0,0 +1,218 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// SymbolBatch
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_SYMBOLBATCH_HPP
+#define GRAMBOL_SYMBOLBATCH_HPP
+
+#include "Symbol.hpp"
+
+namespace grambol
+{
+
+// draws many symbols together: symbols that share a texture (or have no texture) are drawn with one draw call.
+// the symbols are not owned and must outlive the batch (or be removed from it).
+// call update() after modifying symbols; only symbols whose geometry or transform changed are processed again.
+// note that symbols with different textures are drawn in separate groups so their relative order is not kept.
+// a symbol can be given a clip rectangle (in world space, after its transform) to clip it on the CPU, for example
+// to a panel's bounds, so that symbols of many panels can still be drawn together with a single view.
+class SymbolBatch : public sf::Drawable
+{
+public:
+	SymbolBatch() : m_entries(), m_groups(), m_triangles(), m_isRegroupingRequired{ false } { }
+
+	void add(const Symbol& symbol);
+	void add(const Symbol& symbol, sf::FloatRect clipRect);
+	void remove(const Symbol& symbol);
+	void setClipRect(const Symbol& symbol, sf::FloatRect clipRect);
+	void removeClipRect(const Symbol& symbol);
+	void clear();
+	std::size_t getNumberOfSymbols() const;
+	std::size_t getNumberOfDrawCalls() const;
+
+	void update();
+
+private:
+	struct Entry
+	{
+		const Symbol* symbol;
+		std::vector<sf::Vertex> triangles;
+		std::size_t updateCount;
+		sf::Transform transform;
+		const sf::Texture* texture;
+		bool isClipped;
+		sf::FloatRect clipRect;
+		bool isDirty;
+	};
+	struct Group
+	{
+		const sf::Texture* texture;
+		std::vector<sf::Vertex> vertices;
+	};
+
+	std::vector<Entry> m_entries;
+	std::vector<Group> m_groups;
+	std::vector<sf::Vertex> m_triangles;
+	bool m_isRegroupingRequired;
+
+	Entry* priv_findEntry(const Symbol& symbol);
+	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
+
+inline void SymbolBatch::add(const Symbol& symbol)
+{
+	m_entries.push_back({ &symbol, {}, 0u, sf::Transform::Identity, nullptr, false, {}, true });
+	m_isRegroupingRequired = true;
+}
+
+inline void SymbolBatch::add(const Symbol& symbol, const sf::FloatRect clipRect)
+{
+	m_entries.push_back({ &symbol, {}, 0u, sf::Transform::Identity, nullptr, true, clipRect, true });
+	m_isRegroupingRequired = true;
+}
+
+inline void SymbolBatch::remove(const Symbol& symbol)
+{
+	for (auto it{ m_entries.begin() }; it != m_entries.end(); ++it)
+	{
+		if (it->symbol != &symbol)
+			continue;
+		m_entries.erase(it);
+		m_isRegroupingRequired = true;
+		return;
+	}
+}
+
+inline void SymbolBatch::setClipRect(const Symbol& symbol, const sf::FloatRect clipRect)
+{
+	Entry* entry{ priv_findEntry(symbol) };
+	if (entry == nullptr)
+		return;
+	entry->isClipped = true;
+	entry->clipRect = clipRect;
+	entry->isDirty = true;
+}
+
+inline void SymbolBatch::removeClipRect(const Symbol& symbol)
+{
+	Entry* entry{ priv_findEntry(symbol) };
+	if ((entry == nullptr) || !entry->isClipped)
+		return;
+	entry->isClipped = false;
+	entry->isDirty = true;
+}
+
+inline void SymbolBatch::clear()
+{
+	m_entries.clear();
+	m_groups.clear();
+	m_isRegroupingRequired = false;
+}
+
+inline std::size_t SymbolBatch::getNumberOfSymbols() const
+{
+	return m_entries.size();
+}
+
+inline std::size_t SymbolBatch::getNumberOfDrawCalls() const
+{
+	return m_groups.size();
+}
+
+inline void SymbolBatch::update()
+{
+	for (auto& entry : m_entries)
+	{
+		const Symbol& symbol{ *entry.symbol };
+		const sf::Transform transform{ symbol.priv_getDrawTransform() };
+		if (!entry.isDirty && entry.updateCount == symbol.m_updateCount && entry.transform == transform)
+			continue;
+		entry.triangles.clear();
+		if (entry.isClipped)
+		{
+			m_triangles.clear();
+			priv::appendAsTriangles(m_triangles, symbol.priv_getDrawVertices(), symbol.priv_getDrawPrimitiveType(), transform);
+			geometry::appendClippedTriangles(entry.triangles, m_triangles, entry.clipRect);
+		}
+		else
+			priv::appendAsTriangles(entry.triangles, symbol.priv_getDrawVertices(), symbol.priv_getDrawPrimitiveType(), transform);
+		entry.updateCount = symbol.m_updateCount;
+		entry.transform = transform;
+		entry.texture = symbol.m_texture;
+		entry.isDirty = false;
+		m_isRegroupingRequired = true;
+	}
+	if (!m_isRegroupingRequired)
+		return;
+
+	for (auto& group : m_groups)
+		group.vertices.clear();
+	for (auto& entry : m_entries)
+	{
+		auto group{ m_groups.begin() };
+		while ((group != m_groups.end()) && (group->texture != entry.texture))
+			++group;
+		if (group == m_groups.end())
+			group = m_groups.insert(m_groups.end(), { entry.texture, {} });
+		group->vertices.insert(group->vertices.end(), entry.triangles.begin(), entry.triangles.end());
+	}
+	for (auto group{ m_groups.begin() }; group != m_groups.end();)
+	{
+		if (group->vertices.empty())
+			group = m_groups.erase(group);
+		else
+			++group;
+	}
+	m_isRegroupingRequired = false;
+}
+
+inline SymbolBatch::Entry* SymbolBatch::priv_findEntry(const Symbol& symbol)
+{
+	for (auto& entry : m_entries)
+	{
+		if (entry.symbol == &symbol)
+			return &entry;
+	}
+	return nullptr;
+}
+
+inline void SymbolBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	for (auto& group : m_groups)
+	{
+		GRAMBOL_INSTRUMENTATION_RECORD_DRAW(typeid(*this), group.vertices.size());
+		states.texture = group.texture;
+		priv::submitDraw(target, group.vertices.data(), group.vertices.size(), sf::PrimitiveType::Triangles, states);
+	}
+}
+
+} // namespace grambol
+#endif // GRAMBOL_SYMBOLBATCH_HPP
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// SymbolExtras
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef GRAMBOL_SYMBOLEXTRAS_HPP
+#define GRAMBOL_SYMBOLEXTRAS_HPP
+
+#include <memory>
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include "VertexSwapChain.hpp"
+#include "VertexBudgetLink.hpp"
+#include "RegenerationLink.hpp"
+
+namespace grambol
+{
+namespace priv
+{
+
+// a symbol's state for its opt-in features: clipping, double buffering, a vertex budget and a regeneration scheduler.
+// each member's own copy decides what a copied symbol keeps.
+struct SymbolExtras
+{
+	VertexSwapChainPointer swapChain;
+	bool isClipped{ false };
+	sf::FloatRect clipRect;
+	std::vector<sf::Vertex> clippedVertices;
+	VertexBudgetLink budgetLink;
+	RegenerationLink regenerationLink;
+};
+
+// extras that are only allocated when a feature is first used (so a symbol using none of them only stores a null pointer).
+// assigning from a symbol without extras assigns default extras so that any links are told.
+class SymbolExtrasPointer
+{
+public:
+	SymbolExtrasPointer() : m_extras() { }
+	SymbolExtrasPointer(const SymbolExtrasPointer& other) : m_extras() { if (other) m_extras = std::make_unique<SymbolExtras>(*other); }
+	SymbolExtrasPointer& operator=(const SymbolExtrasPointer& other)
+	{
+		if (this == &other)
+			return *this;
+		if (other)
+			get() = *other;
+		else if (m_extras)
+			*m_extras = SymbolExtras{};
+		return *this;
+	}
+
+	SymbolExtras& get()
+	{
+		if (!m_extras)
+			m_extras = std::make_unique<SymbolExtras>();
+		return *m_extras;
+	}
+	explicit operator bool() const { return static_cast<bool>(m_extras); }
+	SymbolExtras& operator*() const { return *m_extras; }
+	SymbolExtras* operator->() const { return m_extras.get(); }
+
+private:
+	std::unique_ptr<SymbolExtras> m_extras;
+};
+
+} // namespace priv
+} // namespace grambol
+#endif // GRAMBOL_SYMBOLEXTRAS_HPP
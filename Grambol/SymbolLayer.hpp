@@ -0,0 +1,475 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// SymbolLayer
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_SYMBOLLAYER_HPP
+#define GRAMBOL_SYMBOLLAYER_HPP
+
+#include "Symbol.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+#include <unordered_map>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/BlendMode.hpp>
+
+namespace grambol
+{
+
+// retained storage of many symbols in one large vertex buffer.
+// each symbol is given its own range in the buffer; when a symbol changes, only its range (or the part of it that changed) is uploaded again.
+// adding, removing or growing a symbol only uploads its own range: ranges freed by removed (or grown) symbols are reused and
+// changing a symbol's z or blend mode only re-orders the draw calls. compact() re-packs the buffer into drawing order
+// (z, then blend mode, then texture) so that neighbouring symbols with the same states are drawn together.
+// compaction happens automatically when the wasted space is larger than the compaction threshold.
+// symbols with a lower z are drawn first; the order of symbols with the same z is not kept.
+// the symbols are not owned and must outlive the layer (or be removed from it).
+class SymbolLayer : public sf::Drawable
+{
+public:
+	SymbolLayer();
+
+	void add(const Symbol& symbol, int z = 0, sf::BlendMode blendMode = sf::BlendAlpha);
+	void remove(const Symbol& symbol);
+	void clear();
+	std::size_t getNumberOfSymbols() const;
+	void setZ(const Symbol& symbol, int z);
+	void setBlendMode(const Symbol& symbol, sf::BlendMode blendMode);
+
+	void setCompactionThreshold(float wastedRatio); // ratio of unused to used vertices that triggers compaction
+	float getCompactionThreshold() const;
+	void compact();
+
+	void update();
+
+	std::size_t getNumberOfDrawCalls() const;
+	std::size_t getNumberOfVerticesUploaded() const; // during the most recent update
+	std::size_t getBufferSize() const; // total number of vertices (used and unused)
+
+private:
+	struct Entry
+	{
+		const Symbol* symbol;
+		int z;
+		sf::BlendMode blendMode;
+		const sf::Texture* texture;
+		std::size_t first;
+		std::size_t capacity;
+		std::size_t updateCount;
+		sf::Transform transform;
+		bool isDirty;
+	};
+	struct Range
+	{
+		std::size_t first;
+		std::size_t count;
+	};
+	struct Run
+	{
+		std::size_t first;
+		std::size_t count;
+		sf::BlendMode blendMode;
+		const sf::Texture* texture;
+	};
+
+	std::vector<Entry> m_entries;
+	std::unordered_map<const Symbol*, std::size_t> m_entryIndices;
+	std::vector<Range> m_freeRanges;
+	std::vector<sf::Vertex> m_vertices;
+	std::vector<sf::Vertex> m_triangles;
+	std::vector<Run> m_runs;
+	std::vector<std::size_t> m_newEntryIndices;
+	sf::VertexBuffer m_buffer;
+	bool m_isBufferAvailable;
+	bool m_isFullUploadRequired;
+	bool m_isOrderDirty;
+	float m_compactionThreshold;
+	std::size_t m_numberOfUnusedVertices;
+	std::size_t m_numberOfVerticesUploaded;
+
+	static sf::Vertex priv_getUnusedVertex();
+	static std::tuple<int, int, int, int, int, int> priv_getBlendModeKey(const sf::BlendMode& blendMode);
+	static bool priv_isDrawnBefore(const Entry& a, const Entry& b);
+	Entry* priv_findEntry(const Symbol& symbol);
+	void priv_freeRange(std::size_t first, std::size_t count);
+	std::size_t priv_allocateRange(std::size_t count);
+	void priv_upload(std::size_t first, std::size_t count);
+	void priv_updateEntry(Entry& entry);
+	void priv_buildRuns();
+	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
+
+inline SymbolLayer::SymbolLayer()
+	: m_entries()
+	, m_entryIndices()
+	, m_freeRanges()
+	, m_vertices()
+	, m_triangles()
+	, m_runs()
+	, m_newEntryIndices()
+	, m_buffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Dynamic)
+	, m_isBufferAvailable{ sf::VertexBuffer::isAvailable() }
+	, m_isFullUploadRequired{ false }
+	, m_isOrderDirty{ false }
+	, m_compactionThreshold{ 0.5f }
+	, m_numberOfUnusedVertices{ 0u }
+	, m_numberOfVerticesUploaded{ 0u }
+{
+}
+
+// the symbol's range is allocated (and uploaded) by the next update
+inline void SymbolLayer::add(const Symbol& symbol, const int z, const sf::BlendMode blendMode)
+{
+	if (!m_entryIndices.emplace(&symbol, m_entries.size()).second)
+		return;
+	m_entries.push_back({ &symbol, z, blendMode, symbol.m_texture, 0u, 0u, 0u, sf::Transform::Identity, true });
+	m_isOrderDirty = true;
+}
+
+inline void SymbolLayer::remove(const Symbol& symbol)
+{
+	const auto it{ m_entryIndices.find(&symbol) };
+	if (it == m_entryIndices.end())
+		return;
+	const std::size_t entryIndex{ it->second };
+	m_entryIndices.erase(it);
+	priv_freeRange(m_entries[entryIndex].first, m_entries[entryIndex].capacity);
+	const std::size_t lastEntryIndex{ m_entries.size() - 1u };
+	if (entryIndex != lastEntryIndex)
+	{
+		m_entries[entryIndex] = m_entries[lastEntryIndex];
+		m_entryIndices[m_entries[entryIndex].symbol] = entryIndex;
+	}
+	m_entries.pop_back();
+	m_isOrderDirty = true;
+}
+
+inline void SymbolLayer::clear()
+{
+	m_entries.clear();
+	m_entryIndices.clear();
+	m_freeRanges.clear();
+	m_vertices.clear();
+	m_runs.clear();
+	m_numberOfUnusedVertices = 0u;
+	m_isOrderDirty = false;
+	m_isFullUploadRequired = true;
+}
+
+inline std::size_t SymbolLayer::getNumberOfSymbols() const
+{
+	return m_entries.size();
+}
+
+inline void SymbolLayer::setZ(const Symbol& symbol, const int z)
+{
+	Entry* entry{ priv_findEntry(symbol) };
+	if (entry == nullptr)
+		return;
+	entry->z = z;
+	m_isOrderDirty = true;
+}
+
+inline void SymbolLayer::setBlendMode(const Symbol& symbol, const sf::BlendMode blendMode)
+{
+	Entry* entry{ priv_findEntry(symbol) };
+	if (entry == nullptr)
+		return;
+	entry->blendMode = blendMode;
+	m_isOrderDirty = true;
+}
+
+inline void SymbolLayer::setCompactionThreshold(const float wastedRatio)
+{
+	m_compactionThreshold = wastedRatio;
+}
+
+inline float SymbolLayer::getCompactionThreshold() const
+{
+	return m_compactionThreshold;
+}
+
+inline void SymbolLayer::compact()
+{
+	std::stable_sort(m_entries.begin(), m_entries.end(), priv_isDrawnBefore);
+	std::vector<sf::Vertex> vertices;
+	std::size_t first{ 0u };
+	for (auto& entry : m_entries)
+	{
+		const std::size_t count{ priv::getNumberOfTriangleVertices(entry.symbol->priv_getDrawVertices().size(), entry.symbol->priv_getDrawPrimitiveType()) };
+		vertices.insert(vertices.end(), m_vertices.begin() + entry.first, m_vertices.begin() + entry.first + std::min(entry.capacity, count));
+		vertices.resize(first + count, priv_getUnusedVertex());
+		if (entry.capacity < count)
+			entry.isDirty = true;
+		entry.first = first;
+		entry.capacity = count;
+		first += count;
+	}
+	m_vertices.swap(vertices);
+	for (std::size_t i{ 0u }; i < m_entries.size(); ++i)
+		m_entryIndices[m_entries[i].symbol] = i;
+	m_freeRanges.clear();
+	m_numberOfUnusedVertices = 0u;
+	m_isFullUploadRequired = true;
+	m_isOrderDirty = true;
+}
+
+inline void SymbolLayer::update()
+{
+	m_numberOfVerticesUploaded = 0u;
+
+	// symbols added since the last update are given their ranges in drawing order so that they can share draw calls
+	m_newEntryIndices.clear();
+	for (std::size_t i{ 0u }; i < m_entries.size(); ++i)
+	{
+		if (m_entries[i].isDirty && (m_entries[i].capacity == 0u))
+			m_newEntryIndices.push_back(i);
+		else
+			priv_updateEntry(m_entries[i]);
+	}
+	std::stable_sort(m_newEntryIndices.begin(), m_newEntryIndices.end(), [&](const std::size_t a, const std::size_t b) { return priv_isDrawnBefore(m_entries[a], m_entries[b]); });
+	for (auto& entryIndex : m_newEntryIndices)
+		priv_updateEntry(m_entries[entryIndex]);
+
+	if (static_cast<float>(m_numberOfUnusedVertices) > m_compactionThreshold * static_cast<float>(m_vertices.size() - m_numberOfUnusedVertices))
+		compact();
+
+	if (m_isFullUploadRequired)
+	{
+		if (m_isBufferAvailable && (m_buffer.getVertexCount() < m_vertices.size()))
+			m_isBufferAvailable = m_buffer.create(m_vertices.size() * 2u);
+		if (m_isBufferAvailable && !m_vertices.empty())
+			m_isBufferAvailable = m_buffer.update(m_vertices.data(), m_vertices.size(), 0u);
+		m_numberOfVerticesUploaded = m_vertices.size();
+		m_isFullUploadRequired = false;
+	}
+	if (m_isOrderDirty)
+	{
+		priv_buildRuns();
+		m_isOrderDirty = false;
+	}
+}
+
+inline std::size_t SymbolLayer::getNumberOfDrawCalls() const
+{
+	return m_runs.size();
+}
+
+inline std::size_t SymbolLayer::getNumberOfVerticesUploaded() const
+{
+	return m_numberOfVerticesUploaded;
+}
+
+inline std::size_t SymbolLayer::getBufferSize() const
+{
+	return m_vertices.size();
+}
+
+inline sf::Vertex SymbolLayer::priv_getUnusedVertex()
+{
+	return{ { 0.f, 0.f }, sf::Color::Transparent, { 0.f, 0.f } };
+}
+
+inline std::tuple<int, int, int, int, int, int> SymbolLayer::priv_getBlendModeKey(const sf::BlendMode& blendMode)
+{
+	return{
+		static_cast<int>(blendMode.colorSrcFactor),
+		static_cast<int>(blendMode.colorDstFactor),
+		static_cast<int>(blendMode.colorEquation),
+		static_cast<int>(blendMode.alphaSrcFactor),
+		static_cast<int>(blendMode.alphaDstFactor),
+		static_cast<int>(blendMode.alphaEquation) };
+}
+
+// drawing order: z, then blend mode, then texture
+inline bool SymbolLayer::priv_isDrawnBefore(const Entry& a, const Entry& b)
+{
+	if (a.z != b.z)
+		return a.z < b.z;
+	const auto aBlend{ priv_getBlendModeKey(a.blendMode) };
+	const auto bBlend{ priv_getBlendModeKey(b.blendMode) };
+	if (aBlend != bBlend)
+		return aBlend < bBlend;
+	return std::less<const sf::Texture*>()(a.texture, b.texture);
+}
+
+inline SymbolLayer::Entry* SymbolLayer::priv_findEntry(const Symbol& symbol)
+{
+	const auto it{ m_entryIndices.find(&symbol) };
+	return (it == m_entryIndices.end()) ? nullptr : &m_entries[it->second];
+}
+
+inline void SymbolLayer::priv_freeRange(const std::size_t first, const std::size_t count)
+{
+	if (count == 0u)
+		return;
+	// no run covers a free range so its vertices are left as they are (and not uploaded again)
+	m_numberOfUnusedVertices += count;
+
+	// keep free ranges sorted and merged with their neighbours
+	auto it{ std::lower_bound(m_freeRanges.begin(), m_freeRanges.end(), first, [](const Range& range, const std::size_t value) { return range.first < value; }) };
+	it = m_freeRanges.insert(it, { first, count });
+	if ((it + 1) != m_freeRanges.end() && (it->first + it->count == (it + 1)->first))
+	{
+		it->count += (it + 1)->count;
+		m_freeRanges.erase(it + 1);
+	}
+	if (it != m_freeRanges.begin() && ((it - 1)->first + (it - 1)->count == it->first))
+	{
+		(it - 1)->count += it->count;
+		m_freeRanges.erase(it);
+	}
+}
+
+inline std::size_t SymbolLayer::priv_allocateRange(const std::size_t count)
+{
+	for (auto it{ m_freeRanges.begin() }; it != m_freeRanges.end(); ++it)
+	{
+		if (it->count < count)
+			continue;
+		const std::size_t first{ it->first };
+		it->first += count;
+		it->count -= count;
+		if (it->count == 0u)
+			m_freeRanges.erase(it);
+		m_numberOfUnusedVertices -= count;
+		return first;
+	}
+	const std::size_t first{ m_vertices.size() };
+	m_vertices.resize(first + count);
+	if (m_buffer.getVertexCount() < m_vertices.size())
+		m_isFullUploadRequired = true;
+	return first;
+}
+
+inline void SymbolLayer::priv_upload(const std::size_t first, const std::size_t count)
+{
+	if (m_isFullUploadRequired || !m_isBufferAvailable || (count == 0u))
+		return;
+	m_isBufferAvailable = m_buffer.update(m_vertices.data() + first, count, static_cast<unsigned int>(first));
+	m_numberOfVerticesUploaded += count;
+}
+
+inline void SymbolLayer::priv_updateEntry(Entry& entry)
+{
+	const Symbol& symbol{ *entry.symbol };
+	const sf::Transform transform{ symbol.priv_getDrawTransform() };
+	if (!entry.isDirty && entry.updateCount == symbol.m_updateCount && entry.transform == transform)
+		return;
+	if (entry.texture != symbol.m_texture)
+	{
+		entry.texture = symbol.m_texture;
+		m_isOrderDirty = true;
+	}
+	m_triangles.clear();
+	priv::appendAsTriangles(m_triangles, symbol.priv_getDrawVertices(), symbol.priv_getDrawPrimitiveType(), transform);
+
+	// only the triangles using the vertices changed by a single partial update are uploaded again
+	const VertexRange changedVertices{ symbol.m_changedVertices };
+	if (!entry.isDirty && (entry.updateCount + 1u == symbol.m_updateCount) && (entry.transform == transform) && !symbol.getDoubleBuffered() && (changedVertices.count != VertexRange::all))
+	{
+		std::size_t first{ 0u };
+		std::size_t count{ 0u };
+		if (changedVertices.count != 0u)
+			priv::getTriangleVertexSpan(changedVertices.first, changedVertices.first + changedVertices.count - 1u, symbol.priv_getDrawVertices().size(), symbol.priv_getDrawPrimitiveType(), first, count);
+		std::copy(m_triangles.begin() + first, m_triangles.begin() + first + count, m_vertices.begin() + entry.first + first);
+		priv_upload(entry.first + first, count);
+		entry.updateCount = symbol.m_updateCount;
+		return;
+	}
+
+	if (m_triangles.size() > entry.capacity)
+	{
+		priv_freeRange(entry.first, entry.capacity);
+		entry.first = priv_allocateRange(m_triangles.size());
+		entry.capacity = m_triangles.size();
+		m_isOrderDirty = true;
+	}
+	std::copy(m_triangles.begin(), m_triangles.end(), m_vertices.begin() + entry.first);
+	std::fill(m_vertices.begin() + entry.first + m_triangles.size(), m_vertices.begin() + entry.first + entry.capacity, priv_getUnusedVertex());
+	priv_upload(entry.first, entry.capacity);
+	entry.updateCount = symbol.m_updateCount;
+	entry.transform = transform;
+	entry.isDirty = false;
+}
+
+inline void SymbolLayer::priv_buildRuns()
+{
+	std::vector<const Entry*> order;
+	order.reserve(m_entries.size());
+	for (auto& entry : m_entries)
+	{
+		if (entry.capacity > 0u)
+			order.push_back(&entry);
+	}
+	// entries with the same states are ordered by their position in the buffer so that neighbouring ranges merge into one run
+	std::sort(order.begin(), order.end(), [](const Entry* a, const Entry* b)
+	{
+		if (priv_isDrawnBefore(*a, *b))
+			return true;
+		if (priv_isDrawnBefore(*b, *a))
+			return false;
+		return a->first < b->first;
+	});
+
+	m_runs.clear();
+	for (auto& entry : order)
+	{
+		if (!m_runs.empty())
+		{
+			Run& run{ m_runs.back() };
+			if ((run.first + run.count == entry->first) && (run.blendMode == entry->blendMode) && (run.texture == entry->texture))
+			{
+				run.count += entry->capacity;
+				continue;
+			}
+		}
+		m_runs.push_back({ entry->first, entry->capacity, entry->blendMode, entry->texture });
+	}
+}
+
+inline void SymbolLayer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	for (auto& run : m_runs)
+	{
+		GRAMBOL_INSTRUMENTATION_RECORD_DRAW(typeid(*this), run.count);
+		states.blendMode = run.blendMode;
+		states.texture = run.texture;
+		if (m_isBufferAvailable)
+			priv::submitDraw(target, m_buffer, run.first, run.count, m_vertices.data(), states);
+		else
+			priv::submitDraw(target, m_vertices.data() + run.first, run.count, sf::PrimitiveType::Triangles, states);
+	}
+}
+
+} // namespace grambol
+#endif // GRAMBOL_SYMBOLLAYER_HPP
@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// SymbolObservers
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_SYMBOLOBSERVERS_HPP
+#define GRAMBOL_SYMBOLOBSERVERS_HPP
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace grambol
+{
+
+class Symbol;
+
+enum class SymbolChange
+{
+	Geometry, // vertices were regenerated (including size, texture and parameter changes)
+	Color, // only vertex colours changed
+	Transform,
+	Destroyed, // sent from the symbol's destructor: only its address can still be used (e.g. to drop it from a dirty list)
+};
+
+using SymbolObserver = std::function<void(const Symbol& symbol, SymbolChange change)>;
+
+namespace priv
+{
+
+// list of observers that is only allocated when the first observer is added (so unobserved symbols only store a null pointer).
+// copying does not copy the observers: they observe one particular symbol.
+class SymbolObserverList
+{
+public:
+	SymbolObserverList() : m_observers() { }
+	SymbolObserverList(const SymbolObserverList&) : m_observers() { }
+	SymbolObserverList& operator=(const SymbolObserverList&) { return *this; }
+
+	std::size_t add(SymbolObserver observer)
+	{
+		if (!m_observers)
+			m_observers = std::make_unique<Observers>();
+		const std::size_t id{ ++m_observers->lastId };
+		m_observers->entries.push_back({ id, std::move(observer) });
+		return id;
+	}
+	void remove(const std::size_t id)
+	{
+		if (!m_observers)
+			return;
+		std::vector<Entry>& entries{ m_observers->entries };
+		for (auto it{ entries.begin() }; it != entries.end(); ++it)
+		{
+			if (it->id != id)
+				continue;
+			entries.erase(it);
+			break;
+		}
+		if (entries.empty())
+			m_observers.reset();
+	}
+	void notify(const Symbol& symbol, const SymbolChange change) const
+	{
+		if (!m_observers)
+			return;
+		for (auto& entry : m_observers->entries)
+			entry.observer(symbol, change);
+	}
+
+private:
+	struct Entry
+	{
+		std::size_t id;
+		SymbolObserver observer;
+	};
+	struct Observers
+	{
+		std::size_t lastId{ 0u };
+		std::vector<Entry> entries;
+	};
+
+	std::unique_ptr<Observers> m_observers;
+};
+
+} // namespace priv
+} // namespace grambol
+#endif // GRAMBOL_SYMBOLOBSERVERS_HPP
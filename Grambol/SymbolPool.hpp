@@ -0,0 +1,444 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// SymbolPool
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_SYMBOLPOOL_HPP
+#define GRAMBOL_SYMBOLPOOL_HPP
+
+#include "Basics.hpp"
+#include "Arrows.hpp"
+#include "Generators.hpp"
+
+#include <algorithm>
+
+namespace grambol
+{
+
+template <class T>
+class SymbolPool;
+
+namespace priv
+{
+
+// describes how a symbol class is stored in a SymbolPool: its parameters and (non-virtual) vertex generation.
+// load and store copy the parameters from and to an instance of the symbol class.
+template <class T>
+struct SymbolPoolTraits;
+
+template <>
+struct SymbolPoolTraits<Basic<Selection::Basic::Rectangle>>
+{
+	struct Parameters { };
+	static constexpr sf::PrimitiveType primitiveType{ sf::PrimitiveType::TriangleStrip };
+	static std::size_t getNumberOfVertices(const Parameters&) { return generator::getNumberOfRectangleVertices(); }
+	static sf::Vector2f getVertexPosition(const Parameters&, sf::Vector2f, const std::size_t vertexIndex) { return generator::getRectangleVertexPosition(vertexIndex); }
+	static Parameters load(const Basic<Selection::Basic::Rectangle>&) { return{}; }
+	static void store(const Parameters&, Basic<Selection::Basic::Rectangle>&) { }
+};
+
+template <>
+struct SymbolPoolTraits<Basic<Selection::Basic::Ellipse>>
+{
+	struct Parameters { std::size_t numberOfEdges{ 36u }; };
+	static constexpr sf::PrimitiveType primitiveType{ sf::PrimitiveType::TriangleFan };
+	static std::size_t getNumberOfVertices(const Parameters& parameters) { return generator::getNumberOfEllipseVertices(parameters.numberOfEdges); }
+	static sf::Vector2f getVertexPosition(const Parameters& parameters, sf::Vector2f, const std::size_t vertexIndex) { return generator::getEllipseVertexPosition(parameters.numberOfEdges, vertexIndex); }
+	static Parameters load(const Basic<Selection::Basic::Ellipse>& symbol) { return{ symbol.getNumberOfEdges() }; }
+	static void store(const Parameters& parameters, Basic<Selection::Basic::Ellipse>& symbol) { symbol.setNumberOfEdges(parameters.numberOfEdges); }
+};
+
+template <>
+struct SymbolPoolTraits<Basic<Selection::Basic::Star>>
+{
+	struct Parameters { std::size_t numberOfSpikes{ 5u }; float innerDistanceMultiplier{ 0.38196601125010515179541316563436f }; };
+	static constexpr sf::PrimitiveType primitiveType{ sf::PrimitiveType::TriangleFan };
+	static std::size_t getNumberOfVertices(const Parameters& parameters) { return generator::getNumberOfStarVertices(parameters.numberOfSpikes); }
+	static sf::Vector2f getVertexPosition(const Parameters& parameters, sf::Vector2f, const std::size_t vertexIndex) { return generator::getStarVertexPosition(parameters.numberOfSpikes, parameters.innerDistanceMultiplier, vertexIndex); }
+	static Parameters load(const Basic<Selection::Basic::Star>& symbol) { return{ symbol.getNumberOfEdges() / 2u, symbol.getInnerDistanceMultiplier() }; }
+	static void store(const Parameters& parameters, Basic<Selection::Basic::Star>& symbol) { symbol.setNumberOfSpikes(parameters.numberOfSpikes); symbol.setInnerDistanceMultiplier(parameters.innerDistanceMultiplier); }
+};
+
+// pooled arrows always use the optimised topology (the pool draws triangles)
+template <>
+struct SymbolPoolTraits<Arrow<Selection::Arrow::Standard>>
+{
+	struct Parameters { float startThickness{ 10.f }; float endThickness{ 10.f }; float headSize{ 10.f }; float headOvershootSize{ 0.f }; };
+	static constexpr sf::PrimitiveType primitiveType{ sf::PrimitiveType::Triangles };
+	static std::size_t getNumberOfVertices(const Parameters&) { return generator::getNumberOfStandardArrowVertices(true); }
+	static sf::Vector2f getVertexPosition(const Parameters& parameters, const sf::Vector2f size, const std::size_t vertexIndex)
+	{
+		return generator::getStandardArrowVertexPosition(size, parameters.startThickness, parameters.endThickness, parameters.headSize, parameters.headOvershootSize, true, vertexIndex);
+	}
+	static Parameters load(const Arrow<Selection::Arrow::Standard>& symbol) { return{ symbol.getStartThickness(), symbol.getEndThickness(), symbol.getHeadSize(), symbol.getHeadOvershootSize() }; }
+	static void store(const Parameters& parameters, Arrow<Selection::Arrow::Standard>& symbol)
+	{
+		symbol.setThicknesses(parameters.startThickness, parameters.endThickness);
+		symbol.setHeadSize(parameters.headSize);
+		symbol.setHeadOvershootSize(parameters.headOvershootSize);
+	}
+};
+
+} // namespace priv
+
+// compact storage of many symbols of one type (structure of arrays): parameters, sizes, colours and each part of the
+// transform are kept in their own contiguous arrays and vertices are generated by free functions (no virtual calls).
+// all symbols are drawn together from one triangle list with one draw call. call update() after modifying symbols;
+// only modified symbols are generated again (unless a symbol's number of vertices changed).
+// symbols are referenced by index; removing a symbol moves the last symbol into its index.
+// supported types: Basic<Rectangle>, Basic<Ellipse>, Basic<Star> and Arrow<Standard>.
+// symbol instances can be copied into the pool (add) and out of it (assignTo) to edit or draw them individually.
+template <class T>
+class SymbolPool : public sf::Drawable
+{
+public:
+	using Traits = priv::SymbolPoolTraits<T>;
+	using Parameters = typename Traits::Parameters;
+
+	SymbolPool() = default;
+
+	std::size_t add(const Parameters& parameters = {}, sf::Vector2f size = { 0.f, 0.f }, sf::Color color = sf::Color::Black);
+	std::size_t add(const T& symbol);
+	void assignTo(std::size_t index, T& symbol) const;
+	void remove(std::size_t index);
+	void clear();
+	void reserve(std::size_t numberOfSymbols);
+	std::size_t getNumberOfSymbols() const;
+
+	void setParameters(std::size_t index, const Parameters& parameters);
+	const Parameters& getParameters(std::size_t index) const;
+	void setSize(std::size_t index, sf::Vector2f size);
+	sf::Vector2f getSize(std::size_t index) const;
+	void setColor(std::size_t index, sf::Color color);
+	sf::Color getColor(std::size_t index) const;
+	void setPosition(std::size_t index, sf::Vector2f position);
+	sf::Vector2f getPosition(std::size_t index) const;
+	void setRotation(std::size_t index, sf::Angle rotation);
+	sf::Angle getRotation(std::size_t index) const;
+	void setScale(std::size_t index, sf::Vector2f scale);
+	sf::Vector2f getScale(std::size_t index) const;
+	void setOrigin(std::size_t index, sf::Vector2f origin);
+	sf::Vector2f getOrigin(std::size_t index) const;
+	sf::Transform getTransform(std::size_t index) const;
+
+	void update();
+	const std::vector<sf::Vertex>& getVertices() const; // triangles; valid after update()
+
+private:
+	std::vector<Parameters> m_parameters;
+	std::vector<sf::Vector2f> m_sizes;
+	std::vector<sf::Color> m_colors;
+	std::vector<sf::Vector2f> m_positions;
+	std::vector<float> m_rotations; // radians
+	std::vector<sf::Vector2f> m_scales;
+	std::vector<sf::Vector2f> m_origins;
+	std::vector<std::size_t> m_firstVertices;
+	std::vector<bool> m_isDirty;
+	std::vector<std::size_t> m_dirtySymbols;
+	std::vector<sf::Vertex> m_primitive;
+	std::vector<sf::Vertex> m_triangles;
+	std::vector<sf::Vertex> m_vertices;
+	bool m_isLayoutRequired{ false };
+
+	void priv_markDirty(std::size_t index);
+	void priv_generate(std::size_t index);
+	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
+
+template <class T>
+std::size_t SymbolPool<T>::add(const Parameters& parameters, const sf::Vector2f size, const sf::Color color)
+{
+	m_parameters.push_back(parameters);
+	m_sizes.push_back(size);
+	m_colors.push_back(color);
+	m_positions.push_back({ 0.f, 0.f });
+	m_rotations.push_back(0.f);
+	m_scales.push_back({ 1.f, 1.f });
+	m_origins.push_back({ 0.f, 0.f });
+	m_firstVertices.push_back(0u);
+	m_isDirty.push_back(true);
+	m_isLayoutRequired = true;
+	return m_parameters.size() - 1u;
+}
+
+template <class T>
+std::size_t SymbolPool<T>::add(const T& symbol)
+{
+	const std::size_t index{ add(Traits::load(symbol), symbol.getSize(), symbol.getColor()) };
+	m_positions[index] = symbol.getPosition();
+	m_rotations[index] = symbol.getRotation().asRadians();
+	m_scales[index] = symbol.getScale();
+	m_origins[index] = symbol.getOrigin();
+	return index;
+}
+
+template <class T>
+void SymbolPool<T>::assignTo(const std::size_t index, T& symbol) const
+{
+	Traits::store(m_parameters[index], symbol);
+	symbol.setColor(m_colors[index]);
+	symbol.setPosition(m_positions[index]);
+	symbol.setRotation(sf::radians(m_rotations[index]));
+	symbol.setScale(m_scales[index]);
+	symbol.setOrigin(m_origins[index]);
+	symbol.setSize(m_sizes[index]);
+}
+
+template <class T>
+void SymbolPool<T>::remove(const std::size_t index)
+{
+	if (index >= m_parameters.size())
+		return;
+	auto removeFrom = [index](auto& values)
+	{
+		values[index] = values.back();
+		values.pop_back();
+	};
+	removeFrom(m_parameters);
+	removeFrom(m_sizes);
+	removeFrom(m_colors);
+	removeFrom(m_positions);
+	removeFrom(m_rotations);
+	removeFrom(m_scales);
+	removeFrom(m_origins);
+	removeFrom(m_firstVertices);
+	m_isDirty.pop_back();
+	m_isLayoutRequired = true;
+}
+
+template <class T>
+void SymbolPool<T>::clear()
+{
+	*this = SymbolPool();
+}
+
+template <class T>
+void SymbolPool<T>::reserve(const std::size_t numberOfSymbols)
+{
+	m_parameters.reserve(numberOfSymbols);
+	m_sizes.reserve(numberOfSymbols);
+	m_colors.reserve(numberOfSymbols);
+	m_positions.reserve(numberOfSymbols);
+	m_rotations.reserve(numberOfSymbols);
+	m_scales.reserve(numberOfSymbols);
+	m_origins.reserve(numberOfSymbols);
+	m_firstVertices.reserve(numberOfSymbols);
+	m_isDirty.reserve(numberOfSymbols);
+}
+
+template <class T>
+std::size_t SymbolPool<T>::getNumberOfSymbols() const
+{
+	return m_parameters.size();
+}
+
+template <class T>
+void SymbolPool<T>::setParameters(const std::size_t index, const Parameters& parameters)
+{
+	if (Traits::getNumberOfVertices(parameters) != Traits::getNumberOfVertices(m_parameters[index]))
+		m_isLayoutRequired = true;
+	m_parameters[index] = parameters;
+	priv_markDirty(index);
+}
+
+template <class T>
+const typename SymbolPool<T>::Parameters& SymbolPool<T>::getParameters(const std::size_t index) const
+{
+	return m_parameters[index];
+}
+
+template <class T>
+void SymbolPool<T>::setSize(const std::size_t index, const sf::Vector2f size)
+{
+	m_sizes[index] = size;
+	priv_markDirty(index);
+}
+
+template <class T>
+sf::Vector2f SymbolPool<T>::getSize(const std::size_t index) const
+{
+	return m_sizes[index];
+}
+
+template <class T>
+void SymbolPool<T>::setColor(const std::size_t index, const sf::Color color)
+{
+	m_colors[index] = color;
+	priv_markDirty(index);
+}
+
+template <class T>
+sf::Color SymbolPool<T>::getColor(const std::size_t index) const
+{
+	return m_colors[index];
+}
+
+template <class T>
+void SymbolPool<T>::setPosition(const std::size_t index, const sf::Vector2f position)
+{
+	m_positions[index] = position;
+	priv_markDirty(index);
+}
+
+template <class T>
+sf::Vector2f SymbolPool<T>::getPosition(const std::size_t index) const
+{
+	return m_positions[index];
+}
+
+template <class T>
+void SymbolPool<T>::setRotation(const std::size_t index, const sf::Angle rotation)
+{
+	m_rotations[index] = rotation.asRadians();
+	priv_markDirty(index);
+}
+
+template <class T>
+sf::Angle SymbolPool<T>::getRotation(const std::size_t index) const
+{
+	return sf::radians(m_rotations[index]);
+}
+
+template <class T>
+void SymbolPool<T>::setScale(const std::size_t index, const sf::Vector2f scale)
+{
+	m_scales[index] = scale;
+	priv_markDirty(index);
+}
+
+template <class T>
+sf::Vector2f SymbolPool<T>::getScale(const std::size_t index) const
+{
+	return m_scales[index];
+}
+
+template <class T>
+void SymbolPool<T>::setOrigin(const std::size_t index, const sf::Vector2f origin)
+{
+	m_origins[index] = origin;
+	priv_markDirty(index);
+}
+
+template <class T>
+sf::Vector2f SymbolPool<T>::getOrigin(const std::size_t index) const
+{
+	return m_origins[index];
+}
+
+// same as sf::Transformable's transform
+template <class T>
+sf::Transform SymbolPool<T>::getTransform(const std::size_t index) const
+{
+	const float cosine{ std::cos(-m_rotations[index]) };
+	const float sine{ std::sin(-m_rotations[index]) };
+	const sf::Vector2f scale{ m_scales[index] };
+	const sf::Vector2f origin{ m_origins[index] };
+	const sf::Vector2f position{ m_positions[index] };
+	const float scaleXCosine{ scale.x * cosine };
+	const float scaleYCosine{ scale.y * cosine };
+	const float scaleXSine{ scale.x * sine };
+	const float scaleYSine{ scale.y * sine };
+	const float translationX{ -origin.x * scaleXCosine - origin.y * scaleYSine + position.x };
+	const float translationY{ origin.x * scaleXSine - origin.y * scaleYCosine + position.y };
+	return{ scaleXCosine, scaleYSine, translationX, -scaleXSine, scaleYCosine, translationY, 0.f, 0.f, 1.f };
+}
+
+template <class T>
+void SymbolPool<T>::update()
+{
+	GRAMBOL_INSTRUMENTATION_SCOPED_TIMER("SymbolPool::update");
+	if (m_isLayoutRequired)
+	{
+		std::size_t first{ 0u };
+		for (std::size_t i{ 0u }; i < m_parameters.size(); ++i)
+		{
+			m_firstVertices[i] = first;
+			first += priv::getNumberOfTriangleVertices(Traits::getNumberOfVertices(m_parameters[i]), Traits::primitiveType);
+		}
+		m_vertices.resize(first);
+		for (std::size_t i{ 0u }; i < m_parameters.size(); ++i)
+			priv_generate(i);
+		std::fill(m_isDirty.begin(), m_isDirty.end(), false);
+		m_isLayoutRequired = false;
+	}
+	else
+	{
+		for (auto& index : m_dirtySymbols)
+		{
+			if ((index >= m_parameters.size()) || !m_isDirty[index])
+				continue;
+			priv_generate(index);
+			m_isDirty[index] = false;
+		}
+	}
+	m_dirtySymbols.clear();
+}
+
+template <class T>
+const std::vector<sf::Vertex>& SymbolPool<T>::getVertices() const
+{
+	return m_vertices;
+}
+
+template <class T>
+void SymbolPool<T>::priv_markDirty(const std::size_t index)
+{
+	if (m_isDirty[index])
+		return;
+	m_isDirty[index] = true;
+	m_dirtySymbols.push_back(index);
+}
+
+template <class T>
+void SymbolPool<T>::priv_generate(const std::size_t index)
+{
+	const Parameters& parameters{ m_parameters[index] };
+	const sf::Vector2f size{ m_sizes[index] };
+	const sf::Color color{ m_colors[index] };
+	m_primitive.resize(Traits::getNumberOfVertices(parameters));
+	for (std::size_t i{ 0u }; i < m_primitive.size(); ++i)
+	{
+		const sf::Vector2f position{ Traits::getVertexPosition(parameters, size, i) };
+		m_primitive[i] = { { position.x * size.x, position.y * size.y }, color, { 0.f, 0.f } };
+	}
+	m_triangles.clear();
+	priv::appendAsTriangles(m_triangles, m_primitive, Traits::primitiveType, getTransform(index));
+	std::copy(m_triangles.begin(), m_triangles.end(), m_vertices.begin() + m_firstVertices[index]);
+}
+
+template <class T>
+void SymbolPool<T>::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	GRAMBOL_INSTRUMENTATION_RECORD_DRAW(typeid(*this), m_vertices.size());
+	priv::submitDraw(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states);
+}
+
+} // namespace grambol
+#endif // GRAMBOL_SYMBOLPOOL_HPP
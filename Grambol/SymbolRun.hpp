@@ -0,0 +1,396 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// SymbolRun
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_SYMBOLRUN_HPP
+#define GRAMBOL_SYMBOLRUN_HPP
+
+#include "Symbol.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace grambol
+{
+
+// lays out a sequence of symbol references the way text lays out glyphs, and draws them from one vertex array per texture.
+// each reference is placed at the pen position and the pen then moves by the symbol's advance plus the spacing.
+// symbols sit on the baseline of their line; a new line is started when the next symbol would pass the wrap width.
+// a symbol's own transform is not used (only its geometry); the run's transform is applied to the whole run.
+// the same symbol may be referenced many times; its geometry is cached once and regenerated only when it changes.
+// after inserting or removing references, only the references from that point onwards are laid out again.
+// the symbols are not owned and must outlive the run (or be removed from it).
+// a symbol's cached geometry is dropped when its last reference is removed; custom metrics are kept until resetMetrics().
+class SymbolRun : public sf::Drawable, public sf::Transformable
+{
+public:
+	SymbolRun();
+
+	void setSpacing(float spacing); // extra space between neighbouring symbols
+	float getSpacing() const;
+	void setLineHeight(float lineHeight); // distance between baselines (also the first baseline's distance from the top)
+	float getLineHeight() const;
+	void setWrapWidth(float wrapWidth); // zero (default) disables wrapping
+	float getWrapWidth() const;
+
+	// metrics of a symbol (for all of its references); by default, advance is the symbol's width and baseline is its height.
+	// baseline is the distance from the top of the symbol to the baseline.
+	void setMetrics(const Symbol& symbol, float advance, float baseline);
+	void resetMetrics(const Symbol& symbol);
+
+	void append(const Symbol& symbol);
+	void insert(std::size_t index, const Symbol& symbol);
+	void remove(std::size_t index);
+	void clear();
+	std::size_t getNumberOfSymbols() const;
+	const Symbol& getSymbol(std::size_t index) const;
+
+	void update();
+
+	sf::Vector2f getSymbolPosition(std::size_t index) const; // top-left of the symbol (in the run's local space); valid after update()
+	std::size_t getNumberOfLines() const; // valid after update()
+	std::size_t getNumberOfDrawCalls() const;
+
+private:
+	struct Glyph
+	{
+		const Symbol* symbol;
+		std::vector<sf::Vertex> triangles;
+		std::size_t updateCount;
+		std::size_t groupIndex;
+		std::size_t numberOfReferences;
+		float advance;
+		float baseline;
+		bool hasCustomMetrics;
+	};
+	struct Entry
+	{
+		std::size_t glyphIndex;
+		std::size_t groupIndex;
+		std::size_t first;
+		std::size_t line;
+		sf::Vector2f position;
+		float penX;
+	};
+	struct Group
+	{
+		const sf::Texture* texture;
+		std::vector<sf::Vertex> vertices;
+	};
+
+	float m_spacing;
+	float m_lineHeight;
+	float m_wrapWidth;
+	std::vector<Glyph> m_glyphs;
+	std::map<const Symbol*, std::size_t> m_glyphIndices;
+	std::vector<Entry> m_entries;
+	std::vector<Group> m_groups;
+	std::size_t m_firstDirtyEntry;
+
+	std::size_t priv_getGlyphIndex(const Symbol& symbol);
+	void priv_releaseGlyph(std::size_t glyphIndex);
+	std::size_t priv_getGroupIndex(const sf::Texture* texture);
+	void priv_updateGlyph(Glyph& glyph);
+	void priv_invalidateFrom(std::size_t index);
+	void priv_invalidateGlyph(std::size_t glyphIndex);
+	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
+
+inline SymbolRun::SymbolRun()
+	: m_spacing{ 0.f }
+	, m_lineHeight{ 0.f }
+	, m_wrapWidth{ 0.f }
+	, m_glyphs()
+	, m_glyphIndices()
+	, m_entries()
+	, m_groups()
+	, m_firstDirtyEntry{ 0u }
+{
+}
+
+inline void SymbolRun::setSpacing(const float spacing)
+{
+	m_spacing = spacing;
+	priv_invalidateFrom(0u);
+}
+
+inline float SymbolRun::getSpacing() const
+{
+	return m_spacing;
+}
+
+inline void SymbolRun::setLineHeight(const float lineHeight)
+{
+	m_lineHeight = lineHeight;
+	priv_invalidateFrom(0u);
+}
+
+inline float SymbolRun::getLineHeight() const
+{
+	return m_lineHeight;
+}
+
+inline void SymbolRun::setWrapWidth(const float wrapWidth)
+{
+	m_wrapWidth = wrapWidth;
+	priv_invalidateFrom(0u);
+}
+
+inline float SymbolRun::getWrapWidth() const
+{
+	return m_wrapWidth;
+}
+
+inline void SymbolRun::setMetrics(const Symbol& symbol, const float advance, const float baseline)
+{
+	const std::size_t glyphIndex{ priv_getGlyphIndex(symbol) };
+	Glyph& glyph{ m_glyphs[glyphIndex] };
+	glyph.advance = advance;
+	glyph.baseline = baseline;
+	glyph.hasCustomMetrics = true;
+	priv_invalidateGlyph(glyphIndex);
+}
+
+inline void SymbolRun::resetMetrics(const Symbol& symbol)
+{
+	auto it{ m_glyphIndices.find(&symbol) };
+	if (it == m_glyphIndices.end())
+		return;
+	const std::size_t glyphIndex{ it->second };
+	m_glyphs[glyphIndex].hasCustomMetrics = false;
+	if (m_glyphs[glyphIndex].numberOfReferences == 0u)
+	{
+		priv_releaseGlyph(glyphIndex);
+		return;
+	}
+	priv_updateGlyph(m_glyphs[glyphIndex]);
+	priv_invalidateGlyph(glyphIndex);
+}
+
+inline void SymbolRun::append(const Symbol& symbol)
+{
+	insert(m_entries.size(), symbol);
+}
+
+inline void SymbolRun::insert(std::size_t index, const Symbol& symbol)
+{
+	if (index > m_entries.size())
+		index = m_entries.size();
+	priv_invalidateFrom(index);
+	const std::size_t glyphIndex{ priv_getGlyphIndex(symbol) };
+	Glyph& glyph{ m_glyphs[glyphIndex] };
+	if (glyph.numberOfReferences++ == 0u)
+		priv_updateGlyph(glyph); // unreferenced glyphs are not kept up to date
+	m_entries.insert(m_entries.begin() + index, { glyphIndex, 0u, 0u, 0u, { 0.f, 0.f }, 0.f });
+}
+
+inline void SymbolRun::remove(const std::size_t index)
+{
+	if (index >= m_entries.size())
+		return;
+	priv_invalidateFrom(index);
+	const std::size_t glyphIndex{ m_entries[index].glyphIndex };
+	m_entries.erase(m_entries.begin() + index);
+	if ((--m_glyphs[glyphIndex].numberOfReferences == 0u) && !m_glyphs[glyphIndex].hasCustomMetrics)
+		priv_releaseGlyph(glyphIndex);
+}
+
+inline void SymbolRun::clear()
+{
+	m_glyphs.clear();
+	m_glyphIndices.clear();
+	m_entries.clear();
+	m_groups.clear();
+	m_firstDirtyEntry = 0u;
+}
+
+inline std::size_t SymbolRun::getNumberOfSymbols() const
+{
+	return m_entries.size();
+}
+
+inline const Symbol& SymbolRun::getSymbol(const std::size_t index) const
+{
+	return *m_glyphs[m_entries.at(index).glyphIndex].symbol;
+}
+
+inline void SymbolRun::update()
+{
+	for (std::size_t i{ 0u }; i < m_glyphs.size(); ++i)
+	{
+		if ((m_glyphs[i].numberOfReferences == 0u) || (m_glyphs[i].updateCount == m_glyphs[i].symbol->getGeneration()))
+			continue;
+		priv_invalidateGlyph(i);
+		priv_updateGlyph(m_glyphs[i]);
+	}
+
+	for (std::size_t i{ m_firstDirtyEntry }; i < m_entries.size(); ++i)
+	{
+		Entry& entry{ m_entries[i] };
+		const Glyph& glyph{ m_glyphs[entry.glyphIndex] };
+		entry.line = 0u;
+		entry.penX = 0.f;
+		if (i > 0u)
+		{
+			const Entry& previous{ m_entries[i - 1u] };
+			entry.line = previous.line;
+			entry.penX = previous.penX + m_glyphs[previous.glyphIndex].advance + m_spacing;
+			if ((m_wrapWidth > 0.f) && (entry.penX + glyph.advance > m_wrapWidth))
+			{
+				++entry.line;
+				entry.penX = 0.f;
+			}
+		}
+		entry.position = { entry.penX, m_lineHeight * static_cast<float>(entry.line + 1u) - glyph.baseline };
+
+		entry.groupIndex = glyph.groupIndex;
+		std::vector<sf::Vertex>& vertices{ m_groups[entry.groupIndex].vertices };
+		entry.first = vertices.size();
+		for (auto vertex : glyph.triangles)
+		{
+			vertex.position += entry.position;
+			vertices.push_back(vertex);
+		}
+	}
+	m_firstDirtyEntry = m_entries.size();
+}
+
+inline sf::Vector2f SymbolRun::getSymbolPosition(const std::size_t index) const
+{
+	return m_entries.at(index).position;
+}
+
+inline std::size_t SymbolRun::getNumberOfLines() const
+{
+	return m_entries.empty() ? 0u : m_entries.back().line + 1u;
+}
+
+inline std::size_t SymbolRun::getNumberOfDrawCalls() const
+{
+	return static_cast<std::size_t>(std::count_if(m_groups.begin(), m_groups.end(), [](const Group& group) { return !group.vertices.empty(); }));
+}
+
+inline std::size_t SymbolRun::priv_getGlyphIndex(const Symbol& symbol)
+{
+	auto it{ m_glyphIndices.find(&symbol) };
+	if (it != m_glyphIndices.end())
+		return it->second;
+	m_glyphs.push_back({ &symbol, {}, 0u, 0u, 0u, 0.f, 0.f, false });
+	priv_updateGlyph(m_glyphs.back());
+	m_glyphIndices.emplace(&symbol, m_glyphs.size() - 1u);
+	return m_glyphs.size() - 1u;
+}
+
+// drops an unreferenced glyph and shifts the indices of the glyphs after it
+inline void SymbolRun::priv_releaseGlyph(const std::size_t glyphIndex)
+{
+	m_glyphIndices.erase(m_glyphs[glyphIndex].symbol);
+	m_glyphs.erase(m_glyphs.begin() + glyphIndex);
+	for (auto& glyphIndexPair : m_glyphIndices)
+	{
+		if (glyphIndexPair.second > glyphIndex)
+			--glyphIndexPair.second;
+	}
+	for (auto& entry : m_entries)
+	{
+		if (entry.glyphIndex > glyphIndex)
+			--entry.glyphIndex;
+	}
+}
+
+inline std::size_t SymbolRun::priv_getGroupIndex(const sf::Texture* const texture)
+{
+	for (std::size_t i{ 0u }; i < m_groups.size(); ++i)
+	{
+		if (m_groups[i].texture == texture)
+			return i;
+	}
+	m_groups.push_back({ texture, {} });
+	return m_groups.size() - 1u;
+}
+
+inline void SymbolRun::priv_updateGlyph(Glyph& glyph)
+{
+	const Symbol& symbol{ *glyph.symbol };
+	glyph.triangles.clear();
+	priv::appendAsTriangles(glyph.triangles, symbol);
+	glyph.updateCount = symbol.getGeneration();
+	glyph.groupIndex = priv_getGroupIndex(symbol.getTexture());
+	if (!glyph.hasCustomMetrics)
+	{
+		glyph.advance = symbol.getSize().x;
+		glyph.baseline = symbol.getSize().y;
+	}
+}
+
+// removes the vertices of all entries from index onwards; they are laid out again at the next update
+inline void SymbolRun::priv_invalidateFrom(const std::size_t index)
+{
+	if (index >= m_firstDirtyEntry)
+		return;
+	std::vector<bool> isGroupTruncated(m_groups.size(), false);
+	for (std::size_t i{ index }; i < m_firstDirtyEntry; ++i)
+	{
+		const Entry& entry{ m_entries[i] };
+		if (isGroupTruncated[entry.groupIndex])
+			continue;
+		m_groups[entry.groupIndex].vertices.resize(entry.first);
+		isGroupTruncated[entry.groupIndex] = true;
+	}
+	m_firstDirtyEntry = index;
+}
+
+inline void SymbolRun::priv_invalidateGlyph(const std::size_t glyphIndex)
+{
+	for (std::size_t i{ 0u }; i < m_firstDirtyEntry; ++i)
+	{
+		if (m_entries[i].glyphIndex != glyphIndex)
+			continue;
+		priv_invalidateFrom(i);
+		return;
+	}
+}
+
+inline void SymbolRun::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	states.transform *= getTransform();
+	for (auto& group : m_groups)
+	{
+		if (group.vertices.empty())
+			continue;
+		GRAMBOL_INSTRUMENTATION_RECORD_DRAW(typeid(*this), group.vertices.size());
+		states.texture = group.texture;
+		priv::submitDraw(target, group.vertices.data(), group.vertices.size(), sf::PrimitiveType::Triangles, states);
+	}
+}
+
+} // namespace grambol
+#endif // GRAMBOL_SYMBOLRUN_HPP
@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// TopologyAnalysis
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_TOPOLOGYANALYSIS_HPP
+#define GRAMBOL_TOPOLOGYANALYSIS_HPP
+
+#include "Symbol.hpp"
+#include "Geometry.hpp"
+
+#include <algorithm>
+
+namespace grambol
+{
+
+// validation of a symbol's generated triangles (untransformed, in pixels, after clipping if clipped).
+// overlap area is the total area covered by more than one triangle (counted once per overlapping pair).
+struct TopologyAnalysis
+{
+	std::size_t numberOfTriangles{ 0u };
+	std::size_t numberOfDegenerateTriangles{ 0u };
+	float triangleArea{ 0.f }; // sum of the areas of all triangles
+	float overlapArea{ 0.f };
+};
+
+inline TopologyAnalysis analyseTopology(const Symbol& symbol, const float degenerateAreaThreshold = 0.0001f)
+{
+	std::vector<sf::Vertex> triangles;
+	priv::appendAsTriangles(triangles, symbol);
+
+	TopologyAnalysis analysis;
+	analysis.numberOfTriangles = triangles.size() / 3u;
+
+	struct Bounds
+	{
+		sf::Vector2f min;
+		sf::Vector2f max;
+	};
+	std::vector<std::size_t> validTriangles;
+	std::vector<Bounds> bounds;
+	for (std::size_t i{ 0u }; i < analysis.numberOfTriangles; ++i)
+	{
+		const sf::Vector2f a{ triangles[i * 3u].position };
+		const sf::Vector2f b{ triangles[i * 3u + 1u].position };
+		const sf::Vector2f c{ triangles[i * 3u + 2u].position };
+		const float area{ geometry::getTriangleArea(a, b, c) };
+		analysis.triangleArea += area;
+		if (area <= degenerateAreaThreshold)
+		{
+			++analysis.numberOfDegenerateTriangles;
+			continue;
+		}
+		validTriangles.push_back(i);
+		bounds.push_back({ { std::min({ a.x, b.x, c.x }), std::min({ a.y, b.y, c.y }) }, { std::max({ a.x, b.x, c.x }), std::max({ a.y, b.y, c.y }) } });
+	}
+
+	std::vector<sf::Vertex> polygon;
+	std::vector<sf::Vertex> scratch;
+	std::vector<sf::Vector2f> clip(3u);
+	for (std::size_t i{ 0u }; i < validTriangles.size(); ++i)
+	{
+		for (std::size_t j{ i + 1u }; j < validTriangles.size(); ++j)
+		{
+			if ((bounds[i].max.x <= bounds[j].min.x) || (bounds[j].max.x <= bounds[i].min.x) || (bounds[i].max.y <= bounds[j].min.y) || (bounds[j].max.y <= bounds[i].min.y))
+				continue;
+			polygon.assign(triangles.begin() + validTriangles[i] * 3u, triangles.begin() + validTriangles[i] * 3u + 3u);
+			for (std::size_t v{ 0u }; v < 3u; ++v)
+				clip[v] = triangles[validTriangles[j] * 3u + v].position;
+			geometry::clipPolygon(polygon, clip, scratch);
+			if (polygon.empty())
+				continue;
+			const float area{ geometry::getPolygonArea(polygon) };
+			if (area > degenerateAreaThreshold)
+				analysis.overlapArea += area;
+		}
+	}
+	return analysis;
+}
+
+} // namespace grambol
+#endif // GRAMBOL_TOPOLOGYANALYSIS_HPP
@@ -0,0 +1,479 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// Triangulation
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_TRIANGULATION_HPP
+#define GRAMBOL_TRIANGULATION_HPP
+
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <cmath>
+#include <SFML/System/Vector2.hpp>
+
+namespace grambol
+{
+namespace geometry
+{
+
+// triangulates a simple polygon, optionally with (simple, non-touching) holes, in O(n log n).
+// the polygon is split into y-monotone pieces with a sweep line, and each piece is then triangulated in linear time.
+// windings of the outline and holes do not matter. the result is a triangle list (three positions per triangle).
+// input that is found not to be simple (e.g. repeated or touching vertices, as may come from loaded data) gives no triangles.
+std::vector<sf::Vector2f> triangulate(const std::vector<sf::Vector2f>& outline, const std::vector<std::vector<sf::Vector2f>>& holes = {});
+
+namespace priv
+{
+
+class MonotoneTriangulator
+{
+public:
+	MonotoneTriangulator(const std::vector<sf::Vector2f>& outline, const std::vector<std::vector<sf::Vector2f>>& holes);
+	void triangulate(std::vector<sf::Vector2f>& triangles);
+
+private:
+	enum class VertexType
+	{
+		Start,
+		End,
+		Split,
+		Merge,
+		Regular,
+	};
+	struct HalfEdge
+	{
+		std::size_t from;
+		std::size_t to;
+		float angle;
+		bool isVisited;
+	};
+	struct StatusComparison
+	{
+		const MonotoneTriangulator* triangulator;
+		bool operator()(std::size_t a, std::size_t b) const { return triangulator->priv_getSweepX(a) < triangulator->priv_getSweepX(b); }
+	};
+
+	static constexpr std::size_t queryEdge{ static_cast<std::size_t>(-1) };
+
+	std::vector<sf::Vector2f> m_points;
+	std::vector<std::size_t> m_next;
+	std::vector<std::size_t> m_previous;
+	std::vector<std::size_t> m_helpers;
+	std::vector<std::pair<std::size_t, std::size_t>> m_diagonals;
+	sf::Vector2f m_sweepPoint;
+
+	static float priv_cross(sf::Vector2f a, sf::Vector2f b) { return a.x * b.y - a.y * b.x; }
+	bool priv_hasRepeatedPoints() const;
+	bool priv_isAbove(std::size_t a, std::size_t b) const;
+	float priv_getSweepX(std::size_t edge) const;
+	VertexType priv_getVertexType(std::size_t vertex) const;
+	void priv_addRing(const std::vector<sf::Vector2f>& ring, bool isHole);
+	bool priv_findDiagonals();
+	void priv_triangulateMonotone(const std::vector<std::size_t>& face, std::vector<sf::Vector2f>& triangles) const;
+};
+
+inline MonotoneTriangulator::MonotoneTriangulator(const std::vector<sf::Vector2f>& outline, const std::vector<std::vector<sf::Vector2f>>& holes)
+	: m_points()
+	, m_next()
+	, m_previous()
+	, m_helpers()
+	, m_diagonals()
+	, m_sweepPoint()
+{
+	priv_addRing(outline, false);
+	for (auto& hole : holes)
+		priv_addRing(hole, true);
+}
+
+inline void MonotoneTriangulator::priv_addRing(const std::vector<sf::Vector2f>& ring, const bool isHole)
+{
+	// remove consecutive duplicates (including the closing point if the ring is given closed)
+	std::vector<sf::Vector2f> points;
+	for (auto& point : ring)
+	{
+		if (points.empty() || (points.back() != point))
+			points.push_back(point);
+	}
+	while ((points.size() > 1u) && (points.front() == points.back()))
+		points.pop_back();
+	if (points.size() < 3u)
+		return;
+
+	// the interior is always on the left: outline counter-clockwise and holes clockwise (with y pointing up)
+	float doubleArea{ 0.f };
+	for (std::size_t i{ 0u }; i < points.size(); ++i)
+		doubleArea += priv_cross(points[i], points[(i + 1u) % points.size()]);
+	if ((doubleArea < 0.f) != isHole)
+		std::reverse(points.begin(), points.end());
+
+	const std::size_t first{ m_points.size() };
+	const std::size_t numberOfPoints{ points.size() };
+	for (std::size_t i{ 0u }; i < numberOfPoints; ++i)
+	{
+		m_points.push_back(points[i]);
+		m_next.push_back(first + (i + 1u) % numberOfPoints);
+		m_previous.push_back(first + (i + numberOfPoints - 1u) % numberOfPoints);
+	}
+}
+
+inline bool MonotoneTriangulator::priv_hasRepeatedPoints() const
+{
+	std::vector<std::size_t> order(m_points.size());
+	for (std::size_t i{ 0u }; i < order.size(); ++i)
+		order[i] = i;
+	std::sort(order.begin(), order.end(), [this](const std::size_t a, const std::size_t b) { return priv_isAbove(a, b); });
+	for (std::size_t i{ 1u }; i < order.size(); ++i)
+	{
+		if (m_points[order[i - 1u]] == m_points[order[i]])
+			return true;
+	}
+	return false;
+}
+
+inline bool MonotoneTriangulator::priv_isAbove(const std::size_t a, const std::size_t b) const
+{
+	const sf::Vector2f pointA{ m_points[a] };
+	const sf::Vector2f pointB{ m_points[b] };
+	return (pointA.y > pointB.y) || ((pointA.y == pointB.y) && (pointA.x < pointB.x));
+}
+
+// x position of the edge (from vertex "edge" to its next vertex) at the current sweep point
+inline float MonotoneTriangulator::priv_getSweepX(const std::size_t edge) const
+{
+	if (edge == queryEdge)
+		return m_sweepPoint.x;
+	const sf::Vector2f a{ m_points[edge] };
+	const sf::Vector2f b{ m_points[m_next[edge]] };
+	if (a.y == b.y)
+		return std::max(std::min(a.x, b.x), std::min(std::max(a.x, b.x), m_sweepPoint.x));
+	return a.x + (m_sweepPoint.y - a.y) * (b.x - a.x) / (b.y - a.y);
+}
+
+inline MonotoneTriangulator::VertexType MonotoneTriangulator::priv_getVertexType(const std::size_t vertex) const
+{
+	const std::size_t previous{ m_previous[vertex] };
+	const std::size_t next{ m_next[vertex] };
+	const bool isConvex{ priv_cross(m_points[vertex] - m_points[previous], m_points[next] - m_points[vertex]) > 0.f };
+	const bool isPreviousBelow{ priv_isAbove(vertex, previous) };
+	const bool isNextBelow{ priv_isAbove(vertex, next) };
+	if (isPreviousBelow && isNextBelow)
+		return isConvex ? VertexType::Start : VertexType::Split;
+	if (!isPreviousBelow && !isNextBelow)
+		return isConvex ? VertexType::End : VertexType::Merge;
+	return VertexType::Regular;
+}
+
+// returns false if the sweep finds the polygon is not simple (two edges at the same place in the status)
+inline bool MonotoneTriangulator::priv_findDiagonals()
+{
+	const std::size_t numberOfPoints{ m_points.size() };
+	std::vector<std::size_t> order(numberOfPoints);
+	for (std::size_t i{ 0u }; i < numberOfPoints; ++i)
+		order[i] = i;
+	std::sort(order.begin(), order.end(), [this](const std::size_t a, const std::size_t b) { return priv_isAbove(a, b); });
+
+	std::vector<VertexType> types(numberOfPoints);
+	for (std::size_t i{ 0u }; i < numberOfPoints; ++i)
+		types[i] = priv_getVertexType(i);
+
+	m_helpers.assign(numberOfPoints, 0u);
+	std::set<std::size_t, StatusComparison> status{ StatusComparison{ this } };
+	std::vector<std::set<std::size_t, StatusComparison>::iterator> statusEntries(numberOfPoints, status.end());
+
+	bool isSimple{ true };
+	auto insertEdge = [&](const std::size_t edge)
+	{
+		const auto inserted{ status.insert(edge) };
+		if (!inserted.second)
+		{
+			isSimple = false;
+			return;
+		}
+		statusEntries[edge] = inserted.first;
+		m_helpers[edge] = edge;
+	};
+	auto removeEdge = [&](const std::size_t edge)
+	{
+		if (statusEntries[edge] == status.end())
+			return;
+		status.erase(statusEntries[edge]);
+		statusEntries[edge] = status.end();
+	};
+	auto connectToMergeHelper = [&](const std::size_t vertex, const std::size_t edge)
+	{
+		if (types[m_helpers[edge]] == VertexType::Merge)
+			m_diagonals.emplace_back(vertex, m_helpers[edge]);
+	};
+	auto findEdgeToLeft = [&](std::size_t& edge)
+	{
+		auto it{ status.lower_bound(queryEdge) };
+		if (it == status.begin())
+			return false;
+		edge = *(--it);
+		return true;
+	};
+
+	for (auto& vertex : order)
+	{
+		if (!isSimple)
+			return false;
+		m_sweepPoint = m_points[vertex];
+		const std::size_t previousEdge{ m_previous[vertex] };
+		std::size_t leftEdge;
+		switch (types[vertex])
+		{
+		case VertexType::Start:
+			insertEdge(vertex);
+			break;
+		case VertexType::End:
+			connectToMergeHelper(vertex, previousEdge);
+			removeEdge(previousEdge);
+			break;
+		case VertexType::Split:
+			if (findEdgeToLeft(leftEdge))
+			{
+				m_diagonals.emplace_back(vertex, m_helpers[leftEdge]);
+				m_helpers[leftEdge] = vertex;
+			}
+			insertEdge(vertex);
+			break;
+		case VertexType::Merge:
+			connectToMergeHelper(vertex, previousEdge);
+			removeEdge(previousEdge);
+			if (findEdgeToLeft(leftEdge))
+			{
+				connectToMergeHelper(vertex, leftEdge);
+				m_helpers[leftEdge] = vertex;
+			}
+			break;
+		case VertexType::Regular:
+			if (priv_isAbove(previousEdge, vertex)) // interior is to the right
+			{
+				connectToMergeHelper(vertex, previousEdge);
+				removeEdge(previousEdge);
+				insertEdge(vertex);
+			}
+			else if (findEdgeToLeft(leftEdge))
+			{
+				connectToMergeHelper(vertex, leftEdge);
+				m_helpers[leftEdge] = vertex;
+			}
+			break;
+		}
+	}
+	return isSimple;
+}
+
+inline void MonotoneTriangulator::triangulate(std::vector<sf::Vector2f>& triangles)
+{
+	const std::size_t numberOfPoints{ m_points.size() };
+	if ((numberOfPoints < 3u) || priv_hasRepeatedPoints() || !priv_findDiagonals())
+		return;
+
+	// half-edges with the interior on their left: polygon edges and both directions of each diagonal
+	std::vector<HalfEdge> halfEdges;
+	halfEdges.reserve(numberOfPoints + m_diagonals.size() * 2u);
+	auto addHalfEdge = [&](const std::size_t from, const std::size_t to)
+	{
+		const sf::Vector2f direction{ m_points[to] - m_points[from] };
+		halfEdges.push_back({ from, to, std::atan2(direction.y, direction.x), false });
+	};
+	for (std::size_t i{ 0u }; i < numberOfPoints; ++i)
+		addHalfEdge(i, m_next[i]);
+	for (auto& diagonal : m_diagonals)
+	{
+		addHalfEdge(diagonal.first, diagonal.second);
+		addHalfEdge(diagonal.second, diagonal.first);
+	}
+
+	// outgoing half-edges of each vertex, sorted by angle
+	std::vector<std::size_t> outgoingStart(numberOfPoints + 1u, 0u);
+	for (auto& halfEdge : halfEdges)
+		++outgoingStart[halfEdge.from + 1u];
+	for (std::size_t i{ 0u }; i < numberOfPoints; ++i)
+		outgoingStart[i + 1u] += outgoingStart[i];
+	std::vector<std::size_t> outgoing(halfEdges.size());
+	{
+		std::vector<std::size_t> fill(outgoingStart.begin(), outgoingStart.end() - 1);
+		for (std::size_t i{ 0u }; i < halfEdges.size(); ++i)
+			outgoing[fill[halfEdges[i].from]++] = i;
+	}
+	for (std::size_t i{ 0u }; i < numberOfPoints; ++i)
+		std::sort(outgoing.begin() + outgoingStart[i], outgoing.begin() + outgoingStart[i + 1u], [&](const std::size_t a, const std::size_t b) { return halfEdges[a].angle < halfEdges[b].angle; });
+
+	// the next half-edge around a face (keeping it on the left) is the first clockwise from the reverse of the incoming one
+	auto getNextHalfEdge = [&](const std::size_t halfEdgeIndex)
+	{
+		const HalfEdge& halfEdge{ halfEdges[halfEdgeIndex] };
+		const sf::Vector2f reverse{ m_points[halfEdge.from] - m_points[halfEdge.to] };
+		const float reverseAngle{ std::atan2(reverse.y, reverse.x) };
+		const std::size_t begin{ outgoingStart[halfEdge.to] };
+		const std::size_t end{ outgoingStart[halfEdge.to + 1u] };
+		std::size_t best{ outgoing[begin] };
+		float bestTurn{ 10.f };
+		for (std::size_t i{ begin }; i < end; ++i)
+		{
+			const HalfEdge& candidate{ halfEdges[outgoing[i]] };
+			if (candidate.to == halfEdge.from)
+				continue;
+			float turn{ reverseAngle - candidate.angle };
+			if (turn <= 0.f)
+				turn += 2.f * 3.14159265358979f;
+			if (turn < bestTurn)
+			{
+				bestTurn = turn;
+				best = outgoing[i];
+			}
+		}
+		return best;
+	};
+
+	std::vector<std::size_t> face;
+	for (std::size_t i{ 0u }; i < halfEdges.size(); ++i)
+	{
+		if (halfEdges[i].isVisited)
+			continue;
+		face.clear();
+		std::size_t halfEdgeIndex{ i };
+		while (!halfEdges[halfEdgeIndex].isVisited && (face.size() <= halfEdges.size()))
+		{
+			halfEdges[halfEdgeIndex].isVisited = true;
+			face.push_back(halfEdges[halfEdgeIndex].from);
+			halfEdgeIndex = getNextHalfEdge(halfEdgeIndex);
+		}
+		priv_triangulateMonotone(face, triangles);
+	}
+}
+
+inline void MonotoneTriangulator::priv_triangulateMonotone(const std::vector<std::size_t>& face, std::vector<sf::Vector2f>& triangles) const
+{
+	const std::size_t numberOfVertices{ face.size() };
+	if (numberOfVertices < 3u)
+		return;
+	if (numberOfVertices == 3u)
+	{
+		for (auto& vertex : face)
+			triangles.push_back(m_points[vertex]);
+		return;
+	}
+
+	// merge the two chains (walking counter-clockwise from the top is the left chain, down to the bottom)
+	std::size_t top{ 0u };
+	std::size_t bottom{ 0u };
+	for (std::size_t i{ 1u }; i < numberOfVertices; ++i)
+	{
+		if (priv_isAbove(face[i], face[top]))
+			top = i;
+		if (priv_isAbove(face[bottom], face[i]))
+			bottom = i;
+	}
+	std::vector<std::pair<std::size_t, bool>> sorted; // vertex and whether it is on the left chain
+	sorted.reserve(numberOfVertices);
+	sorted.emplace_back(face[top], true);
+	std::size_t left{ (top + 1u) % numberOfVertices };
+	std::size_t right{ (top + numberOfVertices - 1u) % numberOfVertices };
+	while (sorted.size() < numberOfVertices)
+	{
+		const bool isLeftFinished{ left == (bottom + 1u) % numberOfVertices };
+		const bool isRightFinished{ right == bottom };
+		if (!isLeftFinished && (isRightFinished || priv_isAbove(face[left], face[right])))
+		{
+			sorted.emplace_back(face[left], true);
+			left = (left + 1u) % numberOfVertices;
+		}
+		else
+		{
+			sorted.emplace_back(face[right], false);
+			right = (right + numberOfVertices - 1u) % numberOfVertices;
+		}
+	}
+
+	auto addTriangle = [&](const std::size_t a, const std::size_t b, const std::size_t c)
+	{
+		triangles.push_back(m_points[a]);
+		triangles.push_back(m_points[b]);
+		triangles.push_back(m_points[c]);
+	};
+
+	std::vector<std::pair<std::size_t, bool>> stack{ sorted[0u], sorted[1u] };
+	for (std::size_t j{ 2u }; j < numberOfVertices - 1u; ++j)
+	{
+		const std::pair<std::size_t, bool> current{ sorted[j] };
+		if (current.second != stack.back().second)
+		{
+			while (stack.size() > 1u)
+			{
+				const std::size_t vertex{ stack.back().first };
+				stack.pop_back();
+				addTriangle(current.first, vertex, stack.back().first);
+			}
+			stack.clear();
+			stack.push_back(sorted[j - 1u]);
+			stack.push_back(current);
+		}
+		else
+		{
+			std::pair<std::size_t, bool> last{ stack.back() };
+			stack.pop_back();
+			while (!stack.empty())
+			{
+				const float orientation{ priv_cross(m_points[last.first] - m_points[stack.back().first], m_points[current.first] - m_points[stack.back().first]) };
+				if (current.second ? (orientation <= 0.f) : (orientation >= 0.f))
+					break;
+				addTriangle(current.first, last.first, stack.back().first);
+				last = stack.back();
+				stack.pop_back();
+			}
+			stack.push_back(last);
+			stack.push_back(current);
+		}
+	}
+	const std::size_t lowest{ sorted.back().first };
+	while (stack.size() > 1u)
+	{
+		const std::size_t vertex{ stack.back().first };
+		stack.pop_back();
+		addTriangle(lowest, vertex, stack.back().first);
+	}
+}
+
+} // namespace priv
+
+inline std::vector<sf::Vector2f> triangulate(const std::vector<sf::Vector2f>& outline, const std::vector<std::vector<sf::Vector2f>>& holes)
+{
+	std::vector<sf::Vector2f> triangles;
+	priv::MonotoneTriangulator(outline, holes).triangulate(triangles);
+	return triangles;
+}
+
+} // namespace geometry
+} // namespace grambol
+#endif // GRAMBOL_TRIANGULATION_HPP
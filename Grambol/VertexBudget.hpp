@@ -0,0 +1,302 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// VertexBudget
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef GRAMBOL_VERTEXBUDGET_HPP
+#define GRAMBOL_VERTEXBUDGET_HPP
+
+#include "Symbol.hpp"
+
+namespace grambol
+{
+
+// bounds the memory used by the vertices of the symbols added to it. symbols are kept in order of most recent use
+// (being drawn, batched or updated); when the total exceeds the budget, the vertices of the least recently used
+// symbols are released and then regenerated from the symbol's parameters the next time they are needed.
+// the most recently used symbol is never evicted so a single symbol larger than the budget can still be drawn.
+// symbols remove themselves when destroyed; a budget must outlive its symbols or be cleared before they are.
+class VertexBudget : public priv::VertexBudgetBase
+{
+public:
+	struct Statistics
+	{
+		std::size_t numberOfSymbols{ 0u };
+		std::size_t numberOfResidentSymbols{ 0u };
+		std::size_t residentBytes{ 0u };
+		std::size_t peakResidentBytes{ 0u };
+		std::size_t numberOfEvictions{ 0u };
+		std::size_t numberOfRegenerations{ 0u };
+	};
+
+	explicit VertexBudget(std::size_t maximumBytes = 64u * 1024u * 1024u);
+	VertexBudget(const VertexBudget&) = delete;
+	VertexBudget& operator=(const VertexBudget&) = delete;
+	~VertexBudget();
+
+	void setMaximumBytes(std::size_t maximumBytes);
+	std::size_t getMaximumBytes() const;
+
+	// a symbol can be in one budget at a time; adding it to another removes it from the first
+	void add(const Symbol& symbol);
+	void remove(const Symbol& symbol);
+	void clear();
+	bool contains(const Symbol& symbol) const;
+
+	Statistics getStatistics() const;
+	void resetStatistics(); // resets the peak and the eviction and regeneration counts
+
+	virtual void priv_onGenerated(const Symbol& symbol) override;
+	virtual void priv_onUsed(const Symbol& symbol) override;
+	virtual void priv_onDestroyed(const Symbol& symbol) override;
+	virtual void priv_onDiscarded(const Symbol& symbol) override;
+
+private:
+	// intrusive list through the symbols' budget links
+	struct List
+	{
+		const Symbol* first{ nullptr };
+		const Symbol* last{ nullptr };
+	};
+
+	std::size_t m_maximumBytes;
+	List m_resident; // most recently used first
+	List m_evicted;
+	Statistics m_statistics;
+
+	static std::size_t priv_getNumberOfBytes(const Symbol& symbol);
+	static void priv_unlink(List& list, const Symbol& symbol);
+	static void priv_linkFirst(List& list, const Symbol& symbol);
+	void priv_makeResident(const Symbol& symbol);
+	void priv_evict(const Symbol& symbol);
+	void priv_enforce();
+};
+
+inline VertexBudget::VertexBudget(const std::size_t maximumBytes)
+	: m_maximumBytes{ maximumBytes }
+	, m_resident()
+	, m_evicted()
+	, m_statistics()
+{
+}
+
+inline VertexBudget::~VertexBudget()
+{
+	clear();
+}
+
+inline void VertexBudget::setMaximumBytes(const std::size_t maximumBytes)
+{
+	m_maximumBytes = maximumBytes;
+	priv_enforce();
+}
+
+inline std::size_t VertexBudget::getMaximumBytes() const
+{
+	return m_maximumBytes;
+}
+
+inline void VertexBudget::add(const Symbol& symbol)
+{
+	priv::VertexBudgetLink& link{ symbol.m_extras.get().budgetLink };
+	if (link.budget == this)
+		return;
+	if (link.budget != nullptr)
+		link.budget->priv_onDestroyed(symbol);
+	link.budget = this;
+	link.symbol = &symbol;
+	++m_statistics.numberOfSymbols;
+	if (link.isEvicted)
+		priv_linkFirst(m_evicted, symbol);
+	else
+		priv_makeResident(symbol);
+}
+
+inline void VertexBudget::remove(const Symbol& symbol)
+{
+	if (symbol.priv_getBudget() == this)
+		priv_onDestroyed(symbol);
+}
+
+inline void VertexBudget::clear()
+{
+	while (m_resident.first != nullptr)
+		priv_onDestroyed(*m_resident.first);
+	while (m_evicted.first != nullptr)
+		priv_onDestroyed(*m_evicted.first);
+}
+
+inline bool VertexBudget::contains(const Symbol& symbol) const
+{
+	return symbol.priv_getBudget() == this;
+}
+
+inline VertexBudget::Statistics VertexBudget::getStatistics() const
+{
+	return m_statistics;
+}
+
+inline void VertexBudget::resetStatistics()
+{
+	m_statistics.peakResidentBytes = m_statistics.residentBytes;
+	m_statistics.numberOfEvictions = 0u;
+	m_statistics.numberOfRegenerations = 0u;
+}
+
+inline void VertexBudget::priv_onGenerated(const Symbol& symbol)
+{
+	priv::VertexBudgetLink& link{ symbol.m_extras->budgetLink };
+	if (link.isEvicted)
+	{
+		priv_unlink(m_evicted, symbol);
+		link.isEvicted = false;
+	}
+	else
+	{
+		priv_unlink(m_resident, symbol);
+		--m_statistics.numberOfResidentSymbols;
+		m_statistics.residentBytes -= link.numberOfBytes;
+	}
+	priv_makeResident(symbol);
+}
+
+inline void VertexBudget::priv_onUsed(const Symbol& symbol)
+{
+	priv::VertexBudgetLink& link{ symbol.m_extras->budgetLink };
+	if (link.isEvicted)
+	{
+		priv_unlink(m_evicted, symbol);
+		symbol.priv_generateVertices();
+		link.isEvicted = false;
+		++m_statistics.numberOfRegenerations;
+		priv_makeResident(symbol);
+	}
+	else if (m_resident.first != &symbol)
+	{
+		priv_unlink(m_resident, symbol);
+		priv_linkFirst(m_resident, symbol);
+	}
+}
+
+// the symbol keeps its evicted state (if evicted) so that it still regenerates when next needed
+inline void VertexBudget::priv_onDestroyed(const Symbol& symbol)
+{
+	priv::VertexBudgetLink& link{ symbol.m_extras->budgetLink };
+	if (link.isEvicted)
+		priv_unlink(m_evicted, symbol);
+	else
+	{
+		priv_unlink(m_resident, symbol);
+		--m_statistics.numberOfResidentSymbols;
+		m_statistics.residentBytes -= link.numberOfBytes;
+	}
+	--m_statistics.numberOfSymbols;
+	link.numberOfBytes = 0u;
+	link.budget = nullptr;
+	link.symbol = nullptr;
+}
+
+// the symbol has released its vertices itself
+inline void VertexBudget::priv_onDiscarded(const Symbol& symbol)
+{
+	priv::VertexBudgetLink& link{ symbol.m_extras->budgetLink };
+	if (link.isEvicted)
+		return;
+	priv_unlink(m_resident, symbol);
+	link.isEvicted = true;
+	m_statistics.residentBytes -= link.numberOfBytes;
+	link.numberOfBytes = 0u;
+	--m_statistics.numberOfResidentSymbols;
+	priv_linkFirst(m_evicted, symbol);
+}
+
+inline std::size_t VertexBudget::priv_getNumberOfBytes(const Symbol& symbol)
+{
+	return (symbol.m_vertices.capacity() + symbol.m_extras->clippedVertices.capacity()) * sizeof(sf::Vertex);
+}
+
+inline void VertexBudget::priv_unlink(List& list, const Symbol& symbol)
+{
+	priv::VertexBudgetLink& link{ symbol.m_extras->budgetLink };
+	if (link.previous != nullptr)
+		link.previous->m_extras->budgetLink.next = link.next;
+	else
+		list.first = link.next;
+	if (link.next != nullptr)
+		link.next->m_extras->budgetLink.previous = link.previous;
+	else
+		list.last = link.previous;
+	link.previous = nullptr;
+	link.next = nullptr;
+}
+
+inline void VertexBudget::priv_linkFirst(List& list, const Symbol& symbol)
+{
+	priv::VertexBudgetLink& link{ symbol.m_extras->budgetLink };
+	link.previous = nullptr;
+	link.next = list.first;
+	if (list.first != nullptr)
+		list.first->m_extras->budgetLink.previous = &symbol;
+	else
+		list.last = &symbol;
+	list.first = &symbol;
+}
+
+// measures the (unlinked) symbol, makes it the most recently used and evicts others if needed
+inline void VertexBudget::priv_makeResident(const Symbol& symbol)
+{
+	priv::VertexBudgetLink& link{ symbol.m_extras->budgetLink };
+	link.numberOfBytes = priv_getNumberOfBytes(symbol);
+	m_statistics.residentBytes += link.numberOfBytes;
+	++m_statistics.numberOfResidentSymbols;
+	priv_linkFirst(m_resident, symbol);
+	priv_enforce();
+}
+
+inline void VertexBudget::priv_evict(const Symbol& symbol)
+{
+	std::vector<sf::Vertex>().swap(symbol.m_vertices);
+	std::vector<sf::Vertex>().swap(symbol.m_extras->clippedVertices);
+	priv_onDiscarded(symbol);
+	++m_statistics.numberOfEvictions;
+}
+
+// evicts the least recently used symbols; the most recently used is always kept
+inline void VertexBudget::priv_enforce()
+{
+	if (m_statistics.residentBytes > m_statistics.peakResidentBytes)
+		m_statistics.peakResidentBytes = m_statistics.residentBytes;
+	while ((m_statistics.residentBytes > m_maximumBytes) && (m_resident.last != m_resident.first))
+		priv_evict(*m_resident.last);
+}
+
+} // namespace grambol
+#endif // GRAMBOL_VERTEXBUDGET_HPP
@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// VertexBudgetLink
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_VERTEXBUDGETLINK_HPP
+#define GRAMBOL_VERTEXBUDGETLINK_HPP
+
+#include <cstddef>
+
+namespace grambol
+{
+
+class Symbol;
+
+namespace priv
+{
+
+// implemented by VertexBudget; symbols in a budget report through this when their vertices are generated, needed or discarded and when they are destroyed
+class VertexBudgetBase
+{
+public:
+	virtual void priv_onGenerated(const Symbol& symbol) = 0;
+	virtual void priv_onUsed(const Symbol& symbol) = 0;
+	virtual void priv_onDestroyed(const Symbol& symbol) = 0;
+	virtual void priv_onDiscarded(const Symbol& symbol) = 0;
+
+protected:
+	~VertexBudgetBase() = default;
+};
+
+// a symbol's place in its budget's least-recently-used list. copies are not in any budget (but remember if their vertices need regenerating).
+// a symbol assigned to while in a budget is measured again: its vertices (declared before its link) have already been replaced.
+struct VertexBudgetLink
+{
+	VertexBudgetBase* budget{ nullptr };
+	const Symbol* symbol{ nullptr }; // the symbol holding this link (while in a budget)
+	const Symbol* previous{ nullptr };
+	const Symbol* next{ nullptr };
+	std::size_t numberOfBytes{ 0u };
+	bool isEvicted{ false }; // vertices have been released (by the budget or because the symbol does not store them)
+
+	VertexBudgetLink() = default;
+	VertexBudgetLink(const VertexBudgetLink& other) : isEvicted{ other.isEvicted } { }
+	VertexBudgetLink& operator=(const VertexBudgetLink& other)
+	{
+		if (budget == nullptr)
+			isEvicted = other.isEvicted;
+		else if (other.isEvicted)
+			budget->priv_onDiscarded(*symbol);
+		else
+			budget->priv_onGenerated(*symbol);
+		return *this;
+	}
+};
+
+} // namespace priv
+} // namespace grambol
+#endif // GRAMBOL_VERTEXBUDGETLINK_HPP
@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// VertexSwapChain
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAMBOL_VERTEXSWAPCHAIN_HPP
+#define GRAMBOL_VERTEXSWAPCHAIN_HPP
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+
+namespace grambol
+{
+namespace priv
+{
+
+// lock-free hand-over of complete vertex buffers from one writer thread to one reader (render) thread.
+// the writer fills the back buffer and publishes it; the reader swaps the latest published buffer to the front.
+// a third (middle) buffer sits between them so that neither side ever waits for the other.
+class VertexSwapChain
+{
+public:
+	struct Buffer
+	{
+		std::vector<sf::Vertex> vertices;
+		sf::Transform transform;
+		sf::PrimitiveType primitiveType;
+	};
+
+	VertexSwapChain() : m_buffers(), m_back{ 0u }, m_middle{ 1u }, m_front{ 2u } { }
+
+	Buffer& getBack() { return m_buffers[m_back]; }
+	const Buffer& getFront() const { return m_buffers[m_front]; }
+
+	void publish() { m_back = m_middle.exchange(m_back | isFreshFlag, std::memory_order_acq_rel) & indexMask; }
+	bool swap()
+	{
+		if ((m_middle.load(std::memory_order_relaxed) & isFreshFlag) == 0u)
+			return false;
+		m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & indexMask;
+		return true;
+	}
+
+private:
+	static constexpr unsigned int indexMask{ 3u };
+	static constexpr unsigned int isFreshFlag{ 4u };
+
+	Buffer m_buffers[3];
+	unsigned int m_back;
+	std::atomic<unsigned int> m_middle;
+	unsigned int m_front;
+};
+
+// owning pointer to a swap chain; copying creates a separate swap chain starting with the same front buffer.
+class VertexSwapChainPointer
+{
+public:
+	VertexSwapChainPointer() : m_swapChain() { }
+	VertexSwapChainPointer(const VertexSwapChainPointer& other) : m_swapChain() { if (other) create(other->getFront()); }
+	VertexSwapChainPointer& operator=(const VertexSwapChainPointer& other)
+	{
+		if (this == &other)
+			return *this;
+		if (other)
+			create(other->getFront());
+		else
+			reset();
+		return *this;
+	}
+
+	void create(const VertexSwapChain::Buffer& initial)
+	{
+		m_swapChain = std::make_unique<VertexSwapChain>();
+		m_swapChain->getBack() = initial;
+		m_swapChain->publish();
+		m_swapChain->swap();
+	}
+	void reset() { m_swapChain.reset(); }
+	explicit operator bool() const { return static_cast<bool>(m_swapChain); }
+	VertexSwapChain* operator->() const { return m_swapChain.get(); }
+
+private:
+	std::unique_ptr<VertexSwapChain> m_swapChain;
+};
+
+} // namespace priv
+} // namespace grambol
+#endif // GRAMBOL_VERTEXSWAPCHAIN_HPP
@@ -30,8 +30,24 @@
 #ifndef GRAMBOL_ALL_HPP
 #define GRAMBOL_ALL_HPP
 
+#include "Instrumentation.hpp"
 #include "bases.hpp"
 #include "Arrows.hpp"
+#include "ArrowGraph.hpp"
 #include "Basics.hpp"
+#include "PolygonSymbol.hpp"
+#include "StrokedSymbol.hpp"
+#include "Palette.hpp"
+#include "CompositeSymbol.hpp"
+#include "SymbolBatch.hpp"
+#include "SymbolLayer.hpp"
+#include "SymbolRun.hpp"
+#include "SymbolPool.hpp"
+#include "ParticleEmitter.hpp"
+#include "TopologyAnalysis.hpp"
+#include "DistanceField.hpp"
+#include "VertexBudget.hpp"
+#include "RegenerationScheduler.hpp"
+#include "DrawStream.hpp"
 
 #endif // GRAMBOL_ALL_HPP
@@ -0,0 +1,240 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// DistanceFieldTests
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+// headless checks of generateDistanceField against analytic signed distances (positive inside).
+// returns non-zero if any check fails.
+
+#include <Grambol/Arrows.hpp>
+#include <Grambol/Basics.hpp>
+#include <Grambol/DistanceField.hpp>
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+
+unsigned int numberOfFailures{ 0u };
+
+void check(const bool isPassed, const char* const description)
+{
+	if (isPassed)
+		return;
+	++numberOfFailures;
+	std::cerr << "FAILED: " << description << std::endl;
+}
+
+// centre of a texel in the symbol's local space (the field extends past the symbol by padding on every side)
+sf::Vector2f getTexelCentre(const sf::Vector2f size, const sf::Vector2u resolution, const float padding, const unsigned int x, const unsigned int y)
+{
+	const sf::Vector2f fieldSize{ size.x + padding * 2.f, size.y + padding * 2.f };
+	return{ -padding + (x + 0.5f) * fieldSize.x / resolution.x, -padding + (y + 0.5f) * fieldSize.y / resolution.y };
+}
+
+float getRectangleDistance(const sf::Vector2f size, const sf::Vector2f point)
+{
+	const float insideDistance{ std::min(std::min(point.x, size.x - point.x), std::min(point.y, size.y - point.y)) };
+	if (insideDistance >= 0.f)
+		return insideDistance;
+	const float outsideX{ std::max(0.f, std::max(-point.x, point.x - size.x)) };
+	const float outsideY{ std::max(0.f, std::max(-point.y, point.y - size.y)) };
+	return -std::sqrt(outsideX * outsideX + outsideY * outsideY);
+}
+
+// the largest difference between the field and the expected distances
+template <class ExpectedDistance>
+float getMaximumError(const std::vector<float>& distances, const sf::Vector2f size, const sf::Vector2u resolution, const float padding, ExpectedDistance expectedDistance)
+{
+	float maximumError{ 0.f };
+	for (unsigned int y{ 0u }; y < resolution.y; ++y)
+	{
+		for (unsigned int x{ 0u }; x < resolution.x; ++x)
+		{
+			const float distance{ distances[static_cast<std::size_t>(y) * resolution.x + x] };
+			maximumError = std::max(maximumError, std::abs(distance - expectedDistance(getTexelCentre(size, resolution, padding, x, y))));
+		}
+	}
+	return maximumError;
+}
+
+void testRectangle()
+{
+	gr::Basic<gr::Selection::Basic::Rectangle> rectangle;
+	const sf::Vector2f size{ 40.f, 20.f };
+	rectangle.setSize(size);
+	const sf::Vector2u resolution{ 64u, 32u };
+	const float padding{ 8.f };
+	const std::vector<float> distances{ gr::generateDistanceField(rectangle, resolution, padding, 1u) };
+	check(distances.size() == static_cast<std::size_t>(resolution.x) * resolution.y, "rectangle: one distance per texel");
+	check(getMaximumError(distances, size, resolution, padding, [&](const sf::Vector2f point) { return getRectangleDistance(size, point); }) < 0.001f, "rectangle: distances match the analytic values");
+	check(distances.front() < 0.f, "rectangle: corner texel is outside");
+	check(distances[static_cast<std::size_t>(resolution.y / 2u) * resolution.x + resolution.x / 2u] > 0.f, "rectangle: centre texel is inside");
+
+	// the symbol's transform is not used
+	rectangle.setPosition({ 100.f, 100.f });
+	rectangle.setScale({ 3.f, 3.f });
+	check(gr::generateDistanceField(rectangle, resolution, padding, 1u) == distances, "rectangle: transform does not affect the field");
+
+	// rows shared between threads give the same field
+	check(gr::generateDistanceField(rectangle, resolution, padding, 4u) == distances, "rectangle: threaded field matches the single-threaded one");
+}
+
+void testEllipse()
+{
+	// a circle (with enough edges to be close to the analytic distance)
+	gr::Basic<gr::Selection::Basic::Ellipse> circle;
+	const float radius{ 30.f };
+	const sf::Vector2f circleSize{ radius * 2.f, radius * 2.f };
+	circle.setSize(circleSize);
+	circle.setNumberOfEdges(720u);
+	const sf::Vector2u resolution{ 48u, 48u };
+	const float padding{ 6.f };
+	const std::vector<float> circleDistances{ gr::generateDistanceField(circle, resolution, padding, 1u) };
+	const float circleError{ getMaximumError(circleDistances, circleSize, resolution, padding, [&](const sf::Vector2f point)
+	{
+		const sf::Vector2f offset{ point - sf::Vector2f{ radius, radius } };
+		return radius - std::sqrt(offset.x * offset.x + offset.y * offset.y);
+	}) };
+	check(circleError < 0.01f, "ellipse: circle distances match the analytic values");
+
+	// a wider ellipse: the sign matches the analytic inside test away from the edge
+	gr::Basic<gr::Selection::Basic::Ellipse> ellipse;
+	const sf::Vector2f ellipseSize{ 80.f, 30.f };
+	ellipse.setSize(ellipseSize);
+	ellipse.setNumberOfEdges(720u);
+	const std::vector<float> ellipseDistances{ gr::generateDistanceField(ellipse, resolution, padding, 1u) };
+	bool isSignCorrect{ true };
+	for (unsigned int y{ 0u }; y < resolution.y; ++y)
+	{
+		for (unsigned int x{ 0u }; x < resolution.x; ++x)
+		{
+			const sf::Vector2f point{ getTexelCentre(ellipseSize, resolution, padding, x, y) };
+			const float normalisedX{ point.x / (ellipseSize.x / 2.f) - 1.f };
+			const float normalisedY{ point.y / (ellipseSize.y / 2.f) - 1.f };
+			const float value{ normalisedX * normalisedX + normalisedY * normalisedY };
+			if (std::abs(value - 1.f) < 0.01f)
+				continue;
+			if ((value < 1.f) != (ellipseDistances[static_cast<std::size_t>(y) * resolution.x + x] > 0.f))
+				isSignCorrect = false;
+		}
+	}
+	check(isSignCorrect, "ellipse: sign matches the analytic inside test");
+}
+
+// the largest difference between the field and its mirror image (flipped vertically or horizontally)
+float getMaximumMirrorError(const std::vector<float>& distances, const sf::Vector2u resolution, const bool isVertical)
+{
+	float maximumError{ 0.f };
+	for (unsigned int y{ 0u }; y < resolution.y; ++y)
+	{
+		for (unsigned int x{ 0u }; x < resolution.x; ++x)
+		{
+			const unsigned int mirrorX{ isVertical ? x : resolution.x - 1u - x };
+			const unsigned int mirrorY{ isVertical ? resolution.y - 1u - y : y };
+			const float distance{ distances[static_cast<std::size_t>(y) * resolution.x + x] };
+			const float mirrorDistance{ distances[static_cast<std::size_t>(mirrorY) * resolution.x + mirrorX] };
+			maximumError = std::max(maximumError, std::abs(distance - mirrorDistance));
+		}
+	}
+	return maximumError;
+}
+
+void testNonConvex()
+{
+	// the arrow's head overlaps the end of its shaft: one texel per pixel, with texel centres mirrored about the arrow's centre line
+	gr::Arrow<gr::Selection::Arrow::Standard> arrow;
+	const sf::Vector2f arrowSize{ 100.f, 40.f };
+	arrow.setSize(arrowSize);
+	const float padding{ 5.f };
+	const sf::Vector2u arrowResolution{ 110u, 50u };
+	const std::vector<float> arrowDistances{ gr::generateDistanceField(arrow, arrowResolution, padding, 1u) };
+	check(getMaximumMirrorError(arrowDistances, arrowResolution, true) < 0.001f, "arrow: field is symmetric about the centre line");
+	auto getArrowDistance = [&](const sf::Vector2f point)
+	{
+		return arrowDistances[static_cast<std::size_t>(point.y + padding) * arrowResolution.x + static_cast<std::size_t>(point.x + padding)];
+	};
+	check(std::abs(getArrowDistance({ 50.f, 20.f }) - 4.5f) < 0.001f, "arrow: shaft is measured from its sides");
+	check(std::abs(getArrowDistance({ 88.f, 37.f }) + 1.5f) < 0.001f, "arrow: outside the head's back edge is measured from the head");
+	const sf::Vector2f lowerHeadPoint{ 92.5f, 30.5f }; // distance to the lower side of the head, from (100, 20) to (90, 40)
+	const float lowerHeadDistance{ ((100.f - lowerHeadPoint.x) * 2.f + (20.f - lowerHeadPoint.y)) / std::sqrt(5.f) };
+	check(std::abs(getArrowDistance({ 92.f, 30.f }) - lowerHeadDistance) < 0.001f, "arrow: lower half of the head is measured from its side");
+
+	// a star (concave corners) is symmetric about its vertical centre line
+	gr::Basic<gr::Selection::Basic::Star> star;
+	star.setSize({ 100.f, 100.f });
+	const sf::Vector2u starResolution{ 110u, 110u };
+	check(getMaximumMirrorError(gr::generateDistanceField(star, starResolution, padding, 1u), starResolution, false) < 0.01f, "star: field is symmetric about the centre line");
+}
+
+void testEdgeCases()
+{
+	gr::Basic<gr::Selection::Basic::Rectangle> rectangle;
+	const sf::Vector2f size{ 10.f, 10.f };
+	rectangle.setSize(size);
+
+	// a single texel samples the centre of the field
+	const std::vector<float> single{ gr::generateDistanceField(rectangle, { 1u, 1u }, 4.f) };
+	check((single.size() == 1u) && (std::abs(single.front() - 5.f) < 0.001f), "1x1: the only texel holds the centre's distance");
+
+	// without padding, the field covers exactly the symbol's bounds
+	const sf::Vector2u resolution{ 10u, 10u };
+	const std::vector<float> unpadded{ gr::generateDistanceField(rectangle, resolution, 0.f) };
+	check(getMaximumError(unpadded, size, resolution, 0.f, [&](const sf::Vector2f point) { return getRectangleDistance(size, point); }) < 0.001f, "zero padding: distances match the analytic values");
+	check(std::abs(unpadded.front() - 0.5f) < 0.001f, "zero padding: corner texel is half a texel inside");
+
+	// no texels
+	check(gr::generateDistanceField(rectangle, { 0u, 4u }, 2.f).empty(), "zero resolution: no distances");
+
+	// image conversion: the edge is at half alpha
+	const sf::Image image{ gr::createDistanceFieldImage({ -2.f, 0.f, 2.f }, { 3u, 1u }, 2.f) };
+	check(image.getPixel({ 0u, 0u }).a == 0u, "image: alpha is zero at spread outside the edge");
+	check(image.getPixel({ 1u, 0u }).a == 128u, "image: alpha is one half at the edge");
+	check(image.getPixel({ 2u, 0u }).a == 255u, "image: alpha is one at spread inside the edge");
+}
+
+} // namespace
+
+int main()
+{
+	testRectangle();
+	testEllipse();
+	testNonConvex();
+	testEdgeCases();
+	if (numberOfFailures != 0u)
+	{
+		std::cerr << numberOfFailures << " distance field check(s) failed" << std::endl;
+		return 1;
+	}
+	std::cout << "all distance field checks passed" << std::endl;
+	return 0;
+}
@@ -0,0 +1,220 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Grambol (https://github.com/Hapaxia/Grambol)
+// --
+//
+// StrokeTests
+//
+// Copyright(c) 2020-2025 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+// headless checks of the boundary edges and the outlines of StrokedSymbol for shapes made from several (overlapping) triangles.
+// returns non-zero if any check fails.
+
+#include <Grambol/Arrows.hpp>
+#include <Grambol/Basics.hpp>
+#include <Grambol/StrokedSymbol.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <iterator>
+
+namespace
+{
+
+unsigned int numberOfFailures{ 0u };
+
+void check(const bool isPassed, const char* const description)
+{
+	if (isPassed)
+		return;
+	++numberOfFailures;
+	std::cerr << "FAILED: " << description << std::endl;
+}
+
+std::vector<gr::geometry::Edge> getBoundaryEdges(const gr::Symbol& symbol)
+{
+	std::vector<sf::Vertex> triangles;
+	gr::priv::appendAsTriangles(triangles, symbol);
+	const sf::Vector2f size{ symbol.getSize() };
+	return gr::geometry::getBoundaryEdges(triangles, std::max(size.x, size.y) * 0.0001f);
+}
+
+// every edge's end is exactly another edge's start (so the edges form closed loops)
+bool isClosed(const std::vector<gr::geometry::Edge>& edges)
+{
+	for (auto& edge : edges)
+	{
+		std::size_t numberOfStarts{ 0u };
+		std::size_t numberOfEnds{ 0u };
+		for (auto& other : edges)
+		{
+			if (other.start == edge.end)
+				++numberOfStarts;
+			if (other.end == edge.end)
+				++numberOfEnds;
+		}
+		if (numberOfStarts != numberOfEnds)
+			return false;
+	}
+	return true;
+}
+
+bool hasEdge(const std::vector<gr::geometry::Edge>& edges, const sf::Vector2f start, const sf::Vector2f end)
+{
+	for (auto& edge : edges)
+	{
+		if ((edge.start == start) && (edge.end == end))
+			return true;
+	}
+	return false;
+}
+
+// the area enclosed by the edges (positive as the shape is on the positive side of each edge)
+float getEnclosedArea(const std::vector<gr::geometry::Edge>& edges)
+{
+	float doubleArea{ 0.f };
+	for (auto& edge : edges)
+		doubleArea += gr::geometry::getDoubleSignedArea({ 0.f, 0.f }, edge.start, edge.end);
+	return doubleArea / 2.f;
+}
+
+std::vector<sf::Vertex> getOutlineVertices(const gr::StrokedSymbol& stroked)
+{
+	std::vector<sf::Vertex> vertices;
+	stroked.writeVertices(std::back_inserter(vertices));
+	std::vector<sf::Vertex> outline;
+	for (auto& vertex : vertices)
+	{
+		if (vertex.color == stroked.getOutlineColor())
+			outline.push_back(vertex);
+	}
+	return outline;
+}
+
+void testArrow()
+{
+	// the head overlaps the end of the shaft, meeting it part way along its back edge
+	gr::Arrow<gr::Selection::Arrow::Standard> arrow;
+	arrow.setSize({ 100.f, 40.f });
+	const std::vector<gr::geometry::Edge> edges{ getBoundaryEdges(arrow) };
+	check(edges.size() == 7u, "arrow: seven boundary edges");
+	check(isClosed(edges), "arrow: boundary is closed");
+	check(hasEdge(edges, { 90.f, 0.f }, { 100.f, 20.f }) && hasEdge(edges, { 100.f, 20.f }, { 90.f, 40.f }), "arrow: both sides of the head are on the boundary");
+	check(hasEdge(edges, { 90.f, 15.f }, { 90.f, 0.f }) && hasEdge(edges, { 90.f, 40.f }, { 90.f, 25.f }), "arrow: the head's back edge is split where the shaft meets it");
+	check(std::abs(std::abs(getEnclosedArea(edges)) - 1100.f) < 0.01f, "arrow: boundary encloses the shaft and the head");
+
+	// the (inside) outline reaches both tips of the head
+	gr::StrokedSymbol stroked;
+	stroked.setShape<gr::Arrow<gr::Selection::Arrow::Standard>>();
+	stroked.setSize({ 100.f, 40.f });
+	stroked.setOutlineThickness(2.f);
+	float minimumY{ 40.f };
+	float maximumY{ 0.f };
+	for (auto& vertex : getOutlineVertices(stroked))
+	{
+		if (vertex.position.x <= 91.f)
+			continue;
+		minimumY = std::min(minimumY, vertex.position.y);
+		maximumY = std::max(maximumY, vertex.position.y);
+	}
+	check((minimumY < 0.01f) && (maximumY > 39.99f), "arrow: outline covers the whole head");
+}
+
+void testStar()
+{
+	// the points of the top spike are not exactly equal in the triangles
+	gr::Basic<gr::Selection::Basic::Star> star;
+	star.setSize({ 100.f, 100.f });
+	const std::vector<gr::geometry::Edge> edges{ getBoundaryEdges(star) };
+	check(edges.size() == 10u, "star: ten boundary edges");
+	check(isClosed(edges), "star: boundary is closed");
+
+	// a closed centred outline has a (bevel) join at every corner
+	gr::StrokedSymbol stroked;
+	stroked.setShape<gr::Basic<gr::Selection::Basic::Star>>();
+	stroked.setSize({ 100.f, 100.f });
+	stroked.setOutlineThickness(2.f);
+	stroked.setOutlineAlignment(gr::StrokeAlignment::Centre);
+	stroked.setOutlineJoin(gr::StrokeJoin::Bevel);
+	check(getOutlineVertices(stroked).size() == edges.size() * 9u, "star: outline joins every corner");
+}
+
+void testRing()
+{
+	// a full ring ends where it starts
+	gr::Basic<gr::Selection::Basic::Ring> ring;
+	ring.setSize({ 100.f, 100.f });
+	const std::vector<gr::geometry::Edge> edges{ getBoundaryEdges(ring) };
+	check(!edges.empty() && (edges.size() % 2u == 0u), "ring: inner and outer boundaries have the same number of edges");
+	check(isClosed(edges), "ring: boundary is closed");
+
+	gr::StrokedSymbol stroked;
+	stroked.setShape<gr::Basic<gr::Selection::Basic::Ring>>();
+	stroked.setSize({ 100.f, 100.f });
+	stroked.setOutlineThickness(2.f);
+	stroked.setOutlineAlignment(gr::StrokeAlignment::Centre);
+	stroked.setOutlineJoin(gr::StrokeJoin::Bevel);
+	check(getOutlineVertices(stroked).size() == edges.size() * 9u, "ring: outline joins every corner of both loops");
+}
+
+void testResize()
+{
+	// resizing regenerates the outline straight away so its thickness stays in pixels
+	gr::StrokedSymbol stroked;
+	stroked.setShape<gr::Basic<gr::Selection::Basic::Rectangle>>();
+	stroked.setSize({ 100.f, 50.f });
+	stroked.setOutlineThickness(4.f);
+	stroked.setSize({ 200.f, 50.f });
+	check(stroked.getShape().getSize() == sf::Vector2f{ 200.f, 50.f }, "resize: shape takes the new size");
+	float maximumInnerLeft{ 0.f };
+	for (auto& vertex : getOutlineVertices(stroked))
+	{
+		if (vertex.position.x < 50.f)
+			maximumInnerLeft = std::max(maximumInnerLeft, vertex.position.x);
+	}
+	check(std::abs(maximumInnerLeft - 4.f) < 0.001f, "resize: outline keeps its thickness");
+	const std::size_t generation{ stroked.getGeneration() };
+	stroked.update();
+	check(stroked.getGeneration() == generation, "resize: update afterwards has nothing to regenerate");
+}
+
+} // namespace
+
+int main()
+{
+	testArrow();
+	testStar();
+	testRing();
+	testResize();
+	if (numberOfFailures != 0u)
+	{
+		std::cerr << numberOfFailures << " stroke check(s) failed" << std::endl;
+		return 1;
+	}
+	std::cout << "all stroke checks passed" << std::endl;
+	return 0;
+}